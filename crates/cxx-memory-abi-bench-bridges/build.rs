@@ -0,0 +1,62 @@
+use std::path::{Path, PathBuf};
+
+type BoxError = Box<dyn std::error::Error + Send + Sync + 'static>;
+type BoxResult<T> = Result<T, BoxError>;
+
+// NOTE: the same flags as the `cxx-memory-abi` target in `CMakeLists.txt`
+fn configure(build: &mut cc::Build) -> &mut cc::Build {
+    build
+        .flag_if_supported("-fno-rtti")
+        .flag_if_supported("-std=gnu++20")
+        .flag_if_supported("-Werror")
+        .flag_if_supported("-Wall")
+        .flag_if_supported("-Wextra")
+        .flag_if_supported("-pedantic")
+        .flag_if_supported("-Wno-ambiguous-reversed-operator")
+        .flag_if_supported("-Wno-deprecated-anon-enum-enum-conversion")
+        .flag_if_supported("-Wno-deprecated-builtins")
+        .flag_if_supported("-Wno-dollar-in-identifier-extension")
+        .flag_if_supported("-Wno-unused-parameter")
+        .compiler("clang++")
+}
+
+fn collect_modules(dir: &Path, paths: &mut Vec<PathBuf>) -> BoxResult<()> {
+    for entry in std::fs::read_dir(dir)? {
+        let path = entry?.path();
+        if path.is_dir() {
+            collect_modules(&path, paths)?;
+        } else if path.extension().is_some_and(|extension| extension == "rs") {
+            paths.push(path);
+        }
+    }
+    Ok(())
+}
+
+fn main() -> BoxResult<()> {
+    let out_dir = PathBuf::from(std::env::var_os("OUT_DIR").ok_or("`OUT_DIR` is not set")?);
+    let manifest_dir = PathBuf::from(std::env::var_os("CARGO_MANIFEST_DIR").ok_or("`CARGO_MANIFEST_DIR` is not set")?);
+    let src_dir = out_dir.join("src");
+
+    cxx_memory_abi::process_artifacts(Path::new("abi"), &src_dir)?;
+    let mut modules = vec![];
+    collect_modules(&src_dir.join("abi"), &mut modules)?;
+    modules.sort();
+
+    // NOTE: `src/lib.rs` includes this to declare the generated modules by path, since `include!` would otherwise look
+    // for them next to `src/lib.rs`. The path is set on an enclosing module rather than on `abi` itself, so that the
+    // modules declared by `abi.rs` are still looked for in `abi/`.
+    let src_dir_str = src_dir.to_str().ok_or("`OUT_DIR` is not valid UTF-8")?;
+    let index = format!("#[path = {src_dir_str:?}]\nmod src {{\n    pub mod abi;\n}}\npub use src::abi;\n");
+    let index_path = out_dir.join("abi.rs");
+    if std::fs::read_to_string(&index_path).ok().as_deref() != Some(index.as_str()) {
+        std::fs::write(index_path, index)?;
+    }
+
+    // NOTE: the preludes live in `cxx-memory-abi-bench`, which is found under `crates` like in `CMakeLists.txt`
+    configure(&mut cxx_build::bridges(&modules))
+        .include(manifest_dir.join(".."))
+        .try_compile("cxx-memory-abi-bench-bridges")?;
+    println!("cargo:rerun-if-changed=abi");
+    println!("cargo:rerun-if-changed=../cxx-memory-abi-bench/cxx/include");
+    Ok(())
+}
@@ -0,0 +1,8 @@
+//! The bridges that `cxx-memory-abi` generates from `abi/*.json` for the preludes in
+//! `cxx-memory-abi-bench/cxx/include/ops.hxx`. Calling `abi::process_artifacts_into` queries the facts about each of
+//! them through its bridge and generates the bindings from those.
+//!
+//! NOTE: this is a build dependency of `cxx-memory-abi-bench`, so the facts are those of the host that runs its build
+//! script, which is also where the benchmark runs.
+
+include!(concat!(env!("OUT_DIR"), "/abi.rs"));
@@ -0,0 +1,474 @@
+// NOTE: run with `cargo bench -p cxx-memory-abi-bench --bench ops`
+//
+// Prints one `type<TAB>op<TAB>variant<TAB>ns/op` row per measurement, where the variant is one of:
+//
+// - `c++`: the native C++ operation, timed by `cxx/bench/ops.cxx`, which CMake builds as `cxx-memory-abi-bench` so
+//   that it uses the same flags as the `cxx-memory-abi` target; its rows are printed by running it separately
+// - `bridge`: the binding that `build.rs` generates with `cxx-memory-abi` for the prelude in `cxx/include/ops.hxx`,
+//   called from Rust
+// - `rust`: the equivalent operation on the corresponding Rust type
+//
+// The `_n` and `sort` rows time one call over a whole batch, but are reported per element like the other rows. Enable
+// the `cxx-abi-stats` feature to include the cost of recording call statistics in the `bridge` rows.
+
+include!(concat!(env!("OUT_DIR"), "/abi.rs"));
+mod native;
+
+use abi::{pod::Pod, string::StdString, vector::StdVector};
+use core::{fmt::Write, hint::black_box, mem::MaybeUninit, pin::Pin};
+use cxx_memory::{CopyNew, Destruct, EmplaceExtend, New, NewSlice};
+use std::{
+    hash::{BuildHasher, Hash, RandomState},
+    time::Instant,
+};
+
+const BATCH_SIZE: usize = 1024;
+const BATCH_COUNT: usize = 256;
+
+// NOTE: must match `sort_key` in `cxx/bench/ops.cxx`, so that every variant sorts the same permutation
+fn sort_key(index: usize) -> usize {
+    index * 7919 % BATCH_SIZE
+}
+
+#[derive(Clone, Copy, Debug, Default, Eq, Hash, Ord, PartialEq, PartialOrd)]
+struct RustPod {
+    x: i64,
+    y: i64,
+}
+
+// NOTE: the operations timed for each variant of a type. Objects are always constructed in place, since that is the
+// only way the bindings can construct them.
+trait Subject: Ord + Sized {
+    const VARIANT: &'static str;
+
+    // NOTE: operations which only some of the variants implement
+    const CLONE: Option<fn(&Self) -> Self> = None;
+    const HASH: Option<fn(&Self, &RandomState) -> u64> = None;
+    const DEBUG: Option<fn(&Self, &mut String)> = None;
+    const DISPLAY: Option<fn(&Self, &mut String)> = None;
+
+    // NOTE: the arguments of the constructor timed by the `new_with` rows
+    type Args: ?Sized;
+
+    unsafe fn new(this: Pin<&mut MaybeUninit<Self>>);
+
+    unsafe fn new_with(this: Pin<&mut MaybeUninit<Self>>, args: &Self::Args);
+
+    unsafe fn copy_new(that: &Self, this: Pin<&mut MaybeUninit<Self>>);
+
+    unsafe fn move_new(that: Pin<Box<Self>>, this: Pin<&mut MaybeUninit<Self>>);
+
+    unsafe fn new_n(this: Pin<&mut [MaybeUninit<Self>]>);
+
+    unsafe fn copy_new_n(that: &[Self], this: Pin<&mut [MaybeUninit<Self>]>);
+
+    unsafe fn destruct_n(this: Pin<&mut [Self]>);
+
+    // NOTE: appends one element to a full `Vec`, which relocates all of the others
+    fn relocate_n(vec: &mut Vec<Self>);
+
+    fn sort(slice: &mut [Self]);
+}
+
+fn hash<T: Hash>(value: &T, state: &RandomState) -> u64 {
+    state.hash_one(value)
+}
+
+fn debug<T: core::fmt::Debug>(value: &T, out: &mut String) {
+    out.clear();
+    write!(out, "{value:?}").unwrap();
+}
+
+fn display<T: core::fmt::Display>(value: &T, out: &mut String) {
+    out.clear();
+    write!(out, "{value}").unwrap();
+}
+
+macro_rules! impl_subject_rust {
+    () => {
+        const VARIANT: &'static str = "rust";
+        const CLONE: Option<fn(&Self) -> Self> = Some(Self::clone);
+        const HASH: Option<fn(&Self, &RandomState) -> u64> = Some(hash::<Self>);
+        const DEBUG: Option<fn(&Self, &mut String)> = Some(debug::<Self>);
+
+        unsafe fn new(this: Pin<&mut MaybeUninit<Self>>) {
+            this.get_mut().write(Self::default());
+        }
+
+        unsafe fn copy_new(that: &Self, this: Pin<&mut MaybeUninit<Self>>) {
+            this.get_mut().write(that.clone());
+        }
+
+        unsafe fn move_new(that: Pin<Box<Self>>, this: Pin<&mut MaybeUninit<Self>>) {
+            this.get_mut().write(*Pin::into_inner(that));
+        }
+
+        unsafe fn new_n(this: Pin<&mut [MaybeUninit<Self>]>) {
+            for this in this.get_mut() {
+                this.write(Self::default());
+            }
+        }
+
+        unsafe fn copy_new_n(that: &[Self], this: Pin<&mut [MaybeUninit<Self>]>) {
+            for (that, this) in that.iter().zip(this.get_mut()) {
+                this.write(that.clone());
+            }
+        }
+
+        unsafe fn destruct_n(this: Pin<&mut [Self]>) {
+            core::ptr::drop_in_place(this.get_mut() as *mut [Self]);
+        }
+
+        fn relocate_n(vec: &mut Vec<Self>) {
+            vec.push(Self::default());
+        }
+
+        fn sort(slice: &mut [Self]) {
+            slice.sort_unstable();
+        }
+    };
+}
+
+macro_rules! impl_subject_bridge {
+    () => {
+        const VARIANT: &'static str = "bridge";
+
+        unsafe fn new(this: Pin<&mut MaybeUninit<Self>>) {
+            Self::default_new().new(this);
+        }
+
+        unsafe fn copy_new(that: &Self, this: Pin<&mut MaybeUninit<Self>>) {
+            CopyNew::copy_new(that, this);
+        }
+
+        unsafe fn move_new(that: Pin<Box<Self>>, this: Pin<&mut MaybeUninit<Self>>) {
+            cxx_memory::new::mov(that).new(this);
+        }
+
+        unsafe fn new_n(this: Pin<&mut [MaybeUninit<Self>]>) {
+            Self::default_new_n(this.len()).new_slice(this);
+        }
+
+        unsafe fn copy_new_n(that: &[Self], this: Pin<&mut [MaybeUninit<Self>]>) {
+            CopyNew::copy_new_n(that, this);
+        }
+
+        unsafe fn destruct_n(this: Pin<&mut [Self]>) {
+            Destruct::destruct_n(this);
+        }
+
+        fn relocate_n(vec: &mut Vec<Self>) {
+            vec.emplace_extend(Self::default_new_n(1));
+        }
+
+        fn sort(slice: &mut [Self]) {
+            Self::sort_slice(slice);
+        }
+    };
+}
+
+impl Subject for RustPod {
+    type Args = (i64, i64);
+
+    impl_subject_rust!();
+
+    unsafe fn new_with(this: Pin<&mut MaybeUninit<Self>>, &(x, y): &Self::Args) {
+        this.get_mut().write(RustPod { x, y });
+    }
+}
+
+impl Subject for String {
+    type Args = str;
+
+    const DISPLAY: Option<fn(&Self, &mut String)> = Some(display::<Self>);
+
+    impl_subject_rust!();
+
+    unsafe fn new_with(this: Pin<&mut MaybeUninit<Self>>, args: &Self::Args) {
+        this.get_mut().write(String::from(args));
+    }
+}
+
+impl Subject for Vec<i32> {
+    type Args = [i32];
+
+    impl_subject_rust!();
+
+    unsafe fn new_with(this: Pin<&mut MaybeUninit<Self>>, args: &Self::Args) {
+        this.get_mut().write(args.to_vec());
+    }
+}
+
+// NOTE: `Clone` is only generated for trivially copyable types, such as `pod`
+impl Subject for Pod {
+    type Args = (i64, i64);
+
+    const CLONE: Option<fn(&Self) -> Self> = Some(Self::clone);
+    const HASH: Option<fn(&Self, &RandomState) -> u64> = Some(hash::<Self>);
+    const DEBUG: Option<fn(&Self, &mut String)> = Some(debug::<Self>);
+
+    impl_subject_bridge!();
+
+    unsafe fn new_with(this: Pin<&mut MaybeUninit<Self>>, &(x, y): &Self::Args) {
+        native::ffi::new_pod(this.get_unchecked_mut().as_mut_ptr(), x, y);
+    }
+}
+
+impl Subject for StdString {
+    type Args = [u8];
+
+    const HASH: Option<fn(&Self, &RandomState) -> u64> = Some(hash::<Self>);
+    const DEBUG: Option<fn(&Self, &mut String)> = Some(debug::<Self>);
+    const DISPLAY: Option<fn(&Self, &mut String)> = Some(display::<Self>);
+
+    impl_subject_bridge!();
+
+    unsafe fn new_with(this: Pin<&mut MaybeUninit<Self>>, args: &Self::Args) {
+        Self::from_slice(args).new(this);
+    }
+}
+
+impl Subject for StdVector {
+    type Args = [i32];
+
+    impl_subject_bridge!();
+
+    unsafe fn new_with(this: Pin<&mut MaybeUninit<Self>>, args: &Self::Args) {
+        Self::from_slice(args).new(this);
+    }
+}
+
+// NOTE: uninitialized storage for a batch of objects, so that construction and destruction can be timed separately
+struct Batch<T> {
+    slots: Box<[MaybeUninit<T>]>,
+}
+
+impl<T> Batch<T> {
+    fn new() -> Self {
+        Self {
+            slots: Box::new_uninit_slice(BATCH_SIZE),
+        }
+    }
+
+    fn slot(&mut self, index: usize) -> Pin<&mut MaybeUninit<T>> {
+        unsafe { Pin::new_unchecked(&mut self.slots[index]) }
+    }
+
+    fn uninit(&mut self) -> Pin<&mut [MaybeUninit<T>]> {
+        unsafe { Pin::new_unchecked(&mut self.slots[..]) }
+    }
+
+    unsafe fn get(&self, index: usize) -> &T {
+        self.slots[index].assume_init_ref()
+    }
+
+    unsafe fn get_mut(&mut self, index: usize) -> &mut T {
+        self.slots[index].assume_init_mut()
+    }
+
+    unsafe fn init(&mut self) -> &mut [T] {
+        &mut *(&mut self.slots[..] as *mut [MaybeUninit<T>] as *mut [T])
+    }
+
+    unsafe fn destruct(&mut self) {
+        core::ptr::drop_in_place(self.init() as *mut [T]);
+    }
+}
+
+struct Batches<T> {
+    lhs: Batch<T>,
+    rhs: Batch<T>,
+    boxes: Vec<Pin<Box<T>>>,
+    full: Vec<T>,
+}
+
+impl<T> Batches<T> {
+    fn new() -> Self {
+        Self {
+            lhs: Batch::new(),
+            rhs: Batch::new(),
+            boxes: Vec::with_capacity(BATCH_SIZE),
+            full: Vec::new(),
+        }
+    }
+}
+
+fn boxed<S: Subject>(args: &S::Args) -> Pin<Box<S>> {
+    let mut uninit = Box::<S>::new_uninit();
+    unsafe {
+        S::new_with(Pin::new_unchecked(&mut *uninit), args);
+        Box::into_pin(uninit.assume_init())
+    }
+}
+
+// NOTE: `setup` and `teardown` run outside of the timer, once per batch; `timed` runs once per batch and is reported
+// per element, like the rows of `measure`
+fn measure_n<S>(
+    ty: &str,
+    op: &str,
+    variant: &str,
+    state: &mut S,
+    mut setup: impl FnMut(&mut S),
+    mut timed: impl FnMut(&mut S),
+    mut teardown: impl FnMut(&mut S),
+) {
+    let mut elapsed = core::time::Duration::ZERO;
+    for _ in 0 .. BATCH_COUNT {
+        setup(state);
+        let start = Instant::now();
+        timed(state);
+        elapsed += start.elapsed();
+        teardown(state);
+    }
+    let nanos = elapsed.as_nanos() as f64 / (BATCH_SIZE * BATCH_COUNT) as f64;
+    println!("{ty}\t{op}\t{variant}\t{nanos:.2}");
+}
+
+fn measure<S>(
+    ty: &str,
+    op: &str,
+    variant: &str,
+    state: &mut S,
+    setup: impl FnMut(&mut S),
+    mut timed: impl FnMut(&mut S, usize),
+    teardown: impl FnMut(&mut S),
+) {
+    let each = |state: &mut S| {
+        for index in 0 .. BATCH_SIZE {
+            timed(state, black_box(index));
+        }
+    };
+    measure_n(ty, op, variant, state, setup, each, teardown);
+}
+
+fn measure_each(ty: &str, op: &str, variant: &str, mut timed: impl FnMut()) {
+    measure(ty, op, variant, &mut (), |_| {}, |_, _| timed(), |_| {});
+}
+
+// NOTE: `args` are passed to the constructor timed by the `new_with` rows and `key` makes the sort key for an index
+fn run<S: Subject>(ty: &str, args: &S::Args, key: impl Fn(usize) -> Box<S::Args>) {
+    let variant = S::VARIANT;
+    let sample = boxed::<S>(args);
+    let sample = &*sample;
+    let keys = (0 .. BATCH_SIZE).map(|index| key(sort_key(index))).collect::<Vec<_>>();
+
+    let batches = &mut Batches::<S>::new();
+    let none = |_: &mut Batches<S>| {};
+    let fill = |batches: &mut Batches<S>| {
+        for index in 0 .. BATCH_SIZE {
+            unsafe { S::copy_new(sample, batches.lhs.slot(index)) };
+        }
+    };
+    let fill_keys = |batches: &mut Batches<S>| {
+        for (index, key) in keys.iter().enumerate() {
+            unsafe { S::new_with(batches.lhs.slot(index), key) };
+        }
+    };
+    let fill_boxes = |batches: &mut Batches<S>| {
+        for _ in 0 .. BATCH_SIZE {
+            batches.boxes.push(boxed::<S>(args));
+        }
+    };
+    let fill_full = |batches: &mut Batches<S>| {
+        let mut full = Vec::with_capacity(BATCH_SIZE);
+        unsafe {
+            S::new_n(Pin::new_unchecked(&mut full.spare_capacity_mut()[.. BATCH_SIZE]));
+            full.set_len(BATCH_SIZE);
+        }
+        batches.full = full;
+    };
+    let clear = |batches: &mut Batches<S>| unsafe { batches.lhs.destruct() };
+    let clear_rhs = |batches: &mut Batches<S>| unsafe { batches.rhs.destruct() };
+    let clear_both = |batches: &mut Batches<S>| unsafe {
+        batches.lhs.destruct();
+        batches.rhs.destruct();
+    };
+    let clear_full = |batches: &mut Batches<S>| drop(core::mem::take(&mut batches.full));
+
+    let new = |batches: &mut Batches<S>, i: usize| unsafe { S::new(batches.lhs.slot(i)) };
+    measure(ty, "new", variant, batches, none, new, clear);
+
+    let new_with = |batches: &mut Batches<S>, i: usize| unsafe { S::new_with(batches.lhs.slot(i), args) };
+    measure(ty, "new_with", variant, batches, none, new_with, clear);
+
+    let copy_new = |batches: &mut Batches<S>, i: usize| unsafe { S::copy_new(batches.lhs.get(i), batches.rhs.slot(i)) };
+    measure(ty, "copy_new", variant, batches, fill, copy_new, clear_both);
+
+    if let Some(clone) = S::CLONE {
+        let clone = |batches: &mut Batches<S>, i: usize| unsafe {
+            let value = clone(batches.lhs.get(i));
+            batches.rhs.slot(i).get_unchecked_mut().write(value);
+        };
+        measure(ty, "clone", variant, batches, fill, clone, clear_both);
+    }
+
+    // NOTE: moves out of a heap allocation and frees it, which is how a binding is moved with `cxx_memory::new::mov`
+    let move_new = |batches: &mut Batches<S>, i: usize| {
+        let that = batches.boxes.pop().unwrap();
+        unsafe { S::move_new(that, batches.rhs.slot(i)) };
+    };
+    measure(ty, "move_new", variant, batches, fill_boxes, move_new, clear_rhs);
+
+    let destruct = |batches: &mut Batches<S>, i: usize| unsafe { core::ptr::drop_in_place(batches.lhs.get_mut(i)) };
+    measure(ty, "destruct", variant, batches, fill, destruct, none);
+
+    let new_n = |batches: &mut Batches<S>| unsafe { S::new_n(batches.lhs.uninit()) };
+    measure_n(ty, "new_n", variant, batches, none, new_n, clear);
+
+    let copy_new_n = |batches: &mut Batches<S>| unsafe { S::copy_new_n(batches.lhs.init(), batches.rhs.uninit()) };
+    measure_n(ty, "copy_new_n", variant, batches, fill, copy_new_n, clear_both);
+
+    let relocate_n = |batches: &mut Batches<S>| S::relocate_n(&mut batches.full);
+    measure_n(ty, "relocate_n", variant, batches, fill_full, relocate_n, clear_full);
+
+    let destruct_n = |batches: &mut Batches<S>| unsafe { S::destruct_n(Pin::new_unchecked(batches.lhs.init())) };
+    measure_n(ty, "destruct_n", variant, batches, fill, destruct_n, none);
+
+    let sort = |batches: &mut Batches<S>| S::sort(unsafe { batches.lhs.init() });
+    measure_n(ty, "sort", variant, batches, fill_keys, sort, clear);
+
+    let other = boxed::<S>(args);
+    let (lhs, rhs) = (sample, &*other);
+    measure_each(ty, "eq", variant, || {
+        black_box(black_box(lhs) == black_box(rhs));
+    });
+    measure_each(ty, "lt", variant, || {
+        black_box(black_box(lhs) < black_box(rhs));
+    });
+    measure_each(ty, "cmp", variant, || {
+        black_box(black_box(lhs).cmp(black_box(rhs)));
+    });
+
+    if let Some(hash) = S::HASH {
+        let state = RandomState::new();
+        measure_each(ty, "hash", variant, || {
+            black_box(hash(black_box(lhs), &state));
+        });
+    }
+
+    let mut out = String::new();
+    if let Some(debug) = S::DEBUG {
+        measure_each(ty, "debug", variant, || debug(black_box(lhs), &mut out));
+    }
+    if let Some(display) = S::DISPLAY {
+        measure_each(ty, "display", variant, || display(black_box(lhs), &mut out));
+    }
+}
+
+fn main() {
+    println!("type\top\tvariant\tns/op");
+
+    let pod = |key: usize| Box::new((key as i64, -1));
+    run::<RustPod>("pod", &(1, 2), pod);
+    run::<Pod>("pod", &(1, 2), pod);
+
+    let string = "x".repeat(48);
+    run::<String>("std::string", &string, |key| format!("{key:048}").into_boxed_str());
+    run::<StdString>("std::string", string.as_bytes(), |key| {
+        format!("{key:048}").into_bytes().into_boxed_slice()
+    });
+
+    let vector = [1; 16];
+    run::<Vec<i32>>("std::vector<int>", &vector, |key| vec![key as i32; 16].into_boxed_slice());
+    run::<StdVector>("std::vector<int>", &vector, |key| vec![key as i32; 16].into_boxed_slice());
+}
@@ -0,0 +1,15 @@
+#[cxx::bridge]
+pub(crate) mod ffi {
+    #[namespace = "cxx_memory_abi_bench::abi::pod"]
+    unsafe extern "C++" {
+        include!("cxx-memory-abi-bench/cxx/include/ops.hxx");
+
+        #[cxx_name = "pod"]
+        type Pod = crate::abi::pod::Pod;
+    }
+
+    #[namespace = "cxx_memory_abi_bench"]
+    unsafe extern "C++" {
+        unsafe fn new_pod(This: *mut Pod, x: i64, y: i64);
+    }
+}
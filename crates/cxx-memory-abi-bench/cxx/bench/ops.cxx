@@ -0,0 +1,232 @@
+// NOTE: run with `cmake --build build --target cxx-memory-abi-bench && build/cxx-memory-abi-bench`
+//
+// Prints the `c++` rows of `cargo bench -p cxx-memory-abi-bench --bench ops`, which time the native operations wrapped
+// by the prelude. These are built by CMake so that they use the same flags as the `cxx-memory-abi` target.
+
+#include "cxx-memory-abi-bench/cxx/include/ops.hxx"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <sstream>
+#include <string_view>
+
+namespace cxx_memory_abi_bench {
+namespace {
+constexpr size_t batch_size = 1024;
+constexpr size_t batch_count = 256;
+
+// NOTE: must match `sort_key` in `benches/ops/main.rs`, so that every variant sorts the same permutation
+constexpr auto
+sort_key(size_t index) noexcept -> size_t
+{
+  return index * 7919 % batch_size;
+}
+
+template<typename T>
+[[gnu::always_inline]]
+inline auto
+do_not_optimize(T const& value) -> void
+{
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+// NOTE: uninitialized storage for a batch of objects, so that construction and destruction can be timed separately
+template<typename T>
+class batch
+{
+public:
+  auto operator[](size_t index) noexcept -> T*
+  {
+    return data() + index;
+  }
+
+  auto data() noexcept -> T*
+  {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return reinterpret_cast<T*>(storage.data());
+  }
+
+private:
+  alignas(T) std::array<std::byte, sizeof(T) * batch_size> storage;
+};
+
+// NOTE: `setup` and `teardown` run outside of the timer, once per batch; `timed` runs once per batch and is reported
+// per element, like the rows of `measure`
+template<typename Setup, typename Timed, typename Teardown>
+auto
+measure_n(char const* type, char const* op, Setup setup, Timed timed, Teardown teardown) -> void
+{
+  auto elapsed = std::chrono::steady_clock::duration::zero();
+  for (size_t round = 0; round < batch_count; ++round) {
+    setup();
+    auto start = std::chrono::steady_clock::now();
+    timed();
+    elapsed += std::chrono::steady_clock::now() - start;
+    teardown();
+  }
+  auto nanos = std::chrono::duration<double, std::nano>(elapsed).count();
+  std::printf("%s\t%s\tc++\t%.2f\n", type, op, nanos / static_cast<double>(batch_size * batch_count));
+}
+
+template<typename Setup, typename Timed, typename Teardown>
+auto
+measure(char const* type, char const* op, Setup setup, Timed timed, Teardown teardown) -> void
+{
+  auto each = [&] {
+    for (size_t index = 0; index < batch_size; ++index) {
+      timed(index);
+    }
+  };
+  measure_n(type, op, setup, each, teardown);
+}
+
+template<typename Timed>
+auto
+measure_each(char const* type, char const* op, Timed timed) -> void
+{
+  measure(type, op, [] {}, [&](size_t) { timed(); }, [] {});
+}
+
+// NOTE: `new_with` constructs a value from its arguments (rather than by copying) and `make_key` makes the sort key at
+// the given index
+template<typename T, typename NewWith, typename MakeKey>
+auto
+run(char const* type, T const& sample, NewWith new_with, MakeKey make_key) -> void
+{
+  batch<T> lhs;
+  batch<T> rhs;
+  std::vector<std::unique_ptr<T>> boxes;
+  boxes.reserve(batch_size);
+
+  auto none = [] {};
+  auto fill = [&] { std::uninitialized_fill_n(lhs.data(), batch_size, sample); };
+  auto fill_keys = [&] {
+    for (size_t index = 0; index < batch_size; ++index) {
+      new (lhs[index]) T(make_key(sort_key(index)));
+    }
+  };
+  auto fill_boxes = [&] {
+    for (size_t index = 0; index < batch_size; ++index) {
+      boxes.push_back(std::make_unique<T>(sample));
+    }
+  };
+  auto clear = [&] { std::destroy_n(lhs.data(), batch_size); };
+  auto clear_rhs = [&] { std::destroy_n(rhs.data(), batch_size); };
+  auto clear_both = [&] {
+    clear();
+    clear_rhs();
+  };
+
+  measure(type, "new", none, [&](size_t i) { new (lhs[i]) T(); }, clear);
+  measure(type, "new_with", none, [&](size_t i) { new_with(lhs[i]); }, clear);
+  measure(type, "copy_new", fill, [&](size_t i) { new (rhs[i]) T(*lhs[i]); }, clear_both);
+
+  // NOTE: moves out of a heap allocation and frees it, as `cxx_memory::new::mov` does for a `Pin<Box<T>>`
+  auto move_new = [&](size_t i) {
+    auto src = std::move(boxes.back());
+    boxes.pop_back();
+    new (rhs[i]) T(std::move(*src));
+  };
+  measure(type, "move_new", fill_boxes, move_new, clear_rhs);
+
+  measure(type, "destruct", fill, [&](size_t i) { std::destroy_at(lhs[i]); }, none);
+
+  measure_n(type, "new_n", none, [&] { std::uninitialized_value_construct_n(lhs.data(), batch_size); }, clear);
+  measure_n(
+    type, "copy_new_n", fill, [&] { std::uninitialized_copy_n(lhs.data(), batch_size, rhs.data()); }, clear_both);
+
+  // NOTE: appending to a full vector relocates every element, like `EmplaceExtend` does with `MoveNew::move_new_n`
+  std::vector<T> full;
+  auto fill_full = [&] {
+    full.reserve(batch_size);
+    full.assign(batch_size, sample);
+  };
+  auto relocate_n = [&] {
+    full.emplace_back();
+    do_not_optimize(full.data());
+  };
+  measure_n(type, "relocate_n", fill_full, relocate_n, [&] { std::vector<T>().swap(full); });
+
+  measure_n(type, "destruct_n", fill, [&] { std::destroy_n(lhs.data(), batch_size); }, none);
+  measure_n(type, "sort", fill_keys, [&] { std::sort(lhs.data(), lhs.data() + batch_size); }, clear);
+
+  // NOTE: not `const`, so that the compiler cannot hoist the comparisons out of the timed loop
+  T self(sample);
+  T other(sample);
+
+  measure_each(type, "eq", [&] { do_not_optimize(self == other); });
+  measure_each(type, "lt", [&] { do_not_optimize(self < other); });
+  measure_each(type, "cmp", [&] { do_not_optimize(self <=> other == 0); });
+  if constexpr (::cxx_memory::abi::cxx_is_hashable<T>()) {
+    measure_each(type, "hash", [&] { do_not_optimize(std::hash<T>{}(self)); });
+  }
+
+  std::string out;
+  if constexpr (::cxx_memory::abi::cxx_is_debuggable<T>()) {
+    measure_each(type, "debug", [&] {
+      std::ostringstream os;
+      os << self;
+      out = std::move(os).str();
+    });
+  }
+  if constexpr (::cxx_memory::abi::cxx_is_displayable_as_string_view<T>()) {
+    measure_each(type, "display", [&] { do_not_optimize(std::string_view{ self }); });
+  }
+}
+
+// NOTE: the arguments of the `new_with` rows, which must match `main` in `benches/ops/main.rs`
+constexpr std::string_view string_bytes = "xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx";
+constexpr std::array<int, 16> vector_values = { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1 };
+
+auto
+new_pod_with(pod* This) -> void
+{
+  new (This) pod{ .x = 1, .y = 2 };
+}
+
+auto
+new_string_with(std::string* This) -> void
+{
+  new (This) std::string(string_bytes.data(), string_bytes.size());
+}
+
+auto
+new_vector_with(std::vector<int>* This) -> void
+{
+  new (This) std::vector<int>(vector_values.begin(), vector_values.end());
+}
+
+auto
+pod_key(size_t key) -> pod
+{
+  return pod{ .x = static_cast<int64_t>(key), .y = -1 };
+}
+
+auto
+string_key(size_t key) -> std::string
+{
+  auto digits = std::to_string(key);
+  return std::string(string_bytes.size() - digits.size(), '0') + digits;
+}
+
+auto
+vector_key(size_t key) -> std::vector<int>
+{
+  return std::vector<int>(vector_values.size(), static_cast<int>(key));
+}
+} // namespace
+} // namespace cxx_memory_abi_bench
+
+auto
+main() -> int
+{
+  using namespace cxx_memory_abi_bench;
+  std::printf("type\top\tvariant\tns/op\n");
+  run("pod", pod{ .x = 1, .y = 2 }, new_pod_with, pod_key);
+  run("std::string", std::string(string_bytes), new_string_with, string_key);
+  run("std::vector<int>", std::vector<int>(vector_values.begin(), vector_values.end()), new_vector_with, vector_key);
+  return 0;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "cxx-memory-abi/cxx/include/cxx-memory-abi.hxx"
+
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace cxx_memory_abi_bench {
+struct pod
+{
+  int64_t x;
+  int64_t y;
+
+  auto operator==(pod const&) const -> bool = default;
+  auto operator<=>(pod const&) const = default;
+};
+
+inline auto
+operator<<(std::ostream& os, pod const& value) -> std::ostream&
+{
+  return os << "pod { x: " << value.x << ", y: " << value.y << " }";
+}
+} // namespace cxx_memory_abi_bench
+
+template<>
+struct std::hash<cxx_memory_abi_bench::pod>
+{
+  auto operator()(cxx_memory_abi_bench::pod const& value) const noexcept -> size_t
+  {
+    auto hash = std::hash<int64_t>{}(value.x);
+    return hash ^ (std::hash<int64_t>{}(value.y) + 0x9e3779b9U + (hash << 6U) + (hash >> 2U));
+  }
+};
+
+// NOTE: none of these have thread affinity, so their bindings are opted into `Send` and `Sync`
+template<>
+inline constexpr bool cxx_memory::abi::cxx_is_send<cxx_memory_abi_bench::pod> = true;
+template<>
+inline constexpr bool cxx_memory::abi::cxx_is_sync<cxx_memory_abi_bench::pod> = true;
+template<>
+inline constexpr bool cxx_memory::abi::cxx_is_send<std::string> = true;
+template<>
+inline constexpr bool cxx_memory::abi::cxx_is_sync<std::string> = true;
+template<>
+inline constexpr bool cxx_memory::abi::cxx_is_send<std::vector<int>> = true;
+template<>
+inline constexpr bool cxx_memory::abi::cxx_is_sync<std::vector<int>> = true;
+
+// NOTE: `build.rs` generates the bindings for these from the entries in `cxx-memory-abi-bench-bridges/abi`
+namespace cxx_memory_abi_bench::abi::pod {
+CXX_MEMORY_ABI_PRELUDE(pod, ::cxx_memory_abi_bench::pod)
+} // namespace cxx_memory_abi_bench::abi::pod
+
+namespace cxx_memory_abi_bench::abi::string {
+CXX_MEMORY_ABI_PRELUDE(string, ::std::string)
+} // namespace cxx_memory_abi_bench::abi::string
+
+namespace cxx_memory_abi_bench::abi::vector {
+CXX_MEMORY_ABI_PRELUDE(vector, ::std::vector, int)
+} // namespace cxx_memory_abi_bench::abi::vector
+
+namespace cxx_memory_abi_bench {
+// NOTE: the prelude has no constructors taking arguments, so `pod` gets a hand-written one, as a binding would
+auto
+new_pod(abi::pod::pod* This, int64_t x, int64_t y) noexcept -> void;
+} // namespace cxx_memory_abi_bench
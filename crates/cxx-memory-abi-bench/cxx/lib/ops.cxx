@@ -0,0 +1,9 @@
+#include "cxx-memory-abi-bench/cxx/include/ops.hxx"
+
+namespace cxx_memory_abi_bench {
+auto
+new_pod(abi::pod::pod* This, int64_t x, int64_t y) noexcept -> void
+{
+  new (This) pod{ .x = x, .y = y };
+}
+} // namespace cxx_memory_abi_bench
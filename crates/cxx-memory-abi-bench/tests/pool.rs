@@ -0,0 +1,41 @@
+// NOTE: run with `cargo test -p cxx-memory-abi-bench --test pool`
+//
+// Checks that the bindings which `cxx/include/ops.hxx` opts into `Send` and `Sync` can be pooled across threads.
+
+include!(concat!(env!("OUT_DIR"), "/abi.rs"));
+
+use abi::string::StdString;
+use cxx_memory::Pool;
+
+#[test]
+fn pool_is_shared_across_threads() {
+    let pool = Pool::<StdString>::new();
+    std::thread::scope(|scope| {
+        for thread in 0 .. 4u8 {
+            let pool = &pool;
+            scope.spawn(move || {
+                let cache = pool.cache_with_capacity(2);
+                for _ in 0 .. 1000 {
+                    let mut string = cache.take(StdString::default_new());
+                    string.as_mut().extend_from_slice(&[thread]);
+                    assert_eq!(string.as_slice().last(), Some(&thread));
+                }
+            });
+        }
+    });
+    assert!(pool.constructed() <= 4);
+}
+
+#[test]
+fn pooled_objects_are_shared_across_threads() {
+    let pool = Pool::<StdString>::new();
+    let cache = pool.cache();
+    let mut string = cache.take(StdString::default_new());
+    string.as_mut().extend_from_slice(b"shared");
+    let string = &*string;
+    std::thread::scope(|scope| {
+        for _ in 0 .. 4 {
+            scope.spawn(|| assert_eq!(string.as_slice(), b"shared"));
+        }
+    });
+}
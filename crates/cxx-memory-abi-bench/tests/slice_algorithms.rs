@@ -0,0 +1,71 @@
+// NOTE: run with `cargo test -p cxx-memory-abi-bench --test slice_algorithms`
+//
+// Checks the slice algorithms generated for the prelude in `cxx/include/ops.hxx`, which forward to the C++ standard
+// library across the bridge.
+
+include!(concat!(env!("OUT_DIR"), "/abi.rs"));
+
+use abi::string::StdString;
+use core::pin::Pin;
+use cxx_memory::New;
+
+fn strings(values: &[&str]) -> Vec<StdString> {
+    let mut vec = Vec::with_capacity(values.len());
+    for (slot, value) in vec.spare_capacity_mut().iter_mut().zip(values) {
+        unsafe { StdString::from_slice(value.as_bytes()).new(Pin::new_unchecked(slot)) };
+    }
+    unsafe { vec.set_len(values.len()) };
+    vec
+}
+
+fn values(slice: &[StdString]) -> Vec<&str> {
+    slice
+        .iter()
+        .map(|value| core::str::from_utf8(value.as_slice()).unwrap())
+        .collect()
+}
+
+#[test]
+fn sort_slice_sorts() {
+    let mut vec = strings(&["pear", "apple", "fig", "apple", ""]);
+    StdString::sort_slice(&mut vec);
+    assert_eq!(values(&vec), ["", "apple", "apple", "fig", "pear"]);
+}
+
+#[test]
+fn stable_sort_slice_sorts() {
+    let mut vec = strings(&["pear", "apple", "fig", "apple", ""]);
+    StdString::stable_sort_slice(&mut vec);
+    assert_eq!(values(&vec), ["", "apple", "apple", "fig", "pear"]);
+}
+
+#[test]
+fn lower_bound_slice_finds_the_first_element_not_less_than_the_value() {
+    let vec = strings(&["apple", "apple", "fig", "pear"]);
+    let lower_bound = |value: &str| StdString::lower_bound_slice(&vec, &strings(&[value])[0]);
+    assert_eq!(lower_bound(""), 0);
+    assert_eq!(lower_bound("apple"), 0);
+    assert_eq!(lower_bound("banana"), 2);
+    assert_eq!(lower_bound("fig"), 2);
+    assert_eq!(lower_bound("zucchini"), 4);
+    assert_eq!(StdString::lower_bound_slice(&[], &strings(&["fig"])[0]), 0);
+}
+
+#[test]
+fn partition_dedup_slice_splits_off_the_duplicates() {
+    let mut vec = strings(&["a", "a", "b", "a", "a", "a", "c"]);
+    let (dedup, duplicates) = StdString::partition_dedup_slice(&mut vec);
+    assert_eq!(values(dedup), ["a", "b", "a", "c"]);
+    assert_eq!(duplicates.len(), 3);
+}
+
+#[test]
+fn dedup_drops_the_duplicates() {
+    let mut vec = strings(&["a", "a", "b", "a", "a", "a", "c"]);
+    StdString::dedup(&mut vec);
+    assert_eq!(values(&vec), ["a", "b", "a", "c"]);
+
+    let mut vec = strings(&[]);
+    StdString::dedup(&mut vec);
+    assert!(vec.is_empty());
+}
@@ -1,6 +1,36 @@
+use std::path::{Path, PathBuf};
+
 type BoxError = Box<dyn std::error::Error + Send + Sync + 'static>;
 type BoxResult<T> = Result<T, BoxError>;
 
+fn collect_sources(dir: &Path, paths: &mut Vec<PathBuf>) -> BoxResult<()> {
+    for entry in std::fs::read_dir(dir)? {
+        let path = entry?.path();
+        if path.is_dir() {
+            collect_sources(&path, paths)?;
+        } else {
+            paths.push(path);
+        }
+    }
+    Ok(())
+}
+
+// NOTE: `CxxAbiModuleWriter` only re-emits modules whose inputs changed, so it also needs to know when the generator
+// itself changed, which is identified by the FNV-1a hash of its sources
+fn generator_version() -> BoxResult<String> {
+    let mut paths = vec![];
+    collect_sources(Path::new("src"), &mut paths)?;
+    paths.sort();
+    let mut hash = 0xcbf2_9ce4_8422_2325_u64;
+    for path in paths {
+        for byte in path.to_string_lossy().bytes().chain(std::fs::read(&path)?) {
+            hash ^= u64::from(byte);
+            hash = hash.wrapping_mul(0x0100_0000_01b3);
+        }
+    }
+    Ok(format!("{}-{hash:016x}", std::env::var("CARGO_PKG_VERSION")?))
+}
+
 fn main() -> BoxResult<()> {
     // NOTE: cxx-build an empty bridge so that `cxx/include/**/*.hxx` is exported to dependencies
     cxx_build::bridge("src/gen/ctypes.rs")
@@ -17,7 +47,8 @@ fn main() -> BoxResult<()> {
         .flag_if_supported("-Wno-unused-parameter")
         .compiler("clang++")
         .try_compile("cxx-memory-abi")?;
+    println!("cargo:rustc-env=CXX_MEMORY_ABI_GENERATOR_VERSION={}", generator_version()?);
     println!("cargo:rerun-if-changed=cxx");
-    println!("cargo:rerun-if-changed=src/lib.rs");
+    println!("cargo:rerun-if-changed=src");
     Ok(())
 }
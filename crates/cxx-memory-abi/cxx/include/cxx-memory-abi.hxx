@@ -3,13 +3,17 @@
 #include "rust/cxx.h"
 #include "sys/types.h"
 
+#include <algorithm>
+#include <array>
 #include <compare>
 #include <concepts>
+#include <cstring>
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <ostream>
 #include <ranges>
-#include <sstream>
+#include <streambuf>
 #include <type_traits>
 
 // NOLINTBEGIN(google-runtime-int)
@@ -119,7 +123,7 @@ template<typename T, typename It>
 concept is_constructible_from_iterator = requires(It first, It last) { //
   requires std::input_iterator<It>;
   {
-    T{ first, last }
+    T(first, last)
   } -> std::same_as<T>;
 };
 
@@ -143,6 +147,36 @@ concept is_input_move_iterator = requires { //
   requires std::input_iterator<T>;
   requires std::same_as<std::iter_reference_t<T>, std::add_rvalue_reference_t<std::iter_value_t<T>>>;
 };
+
+template<typename T, typename It>
+concept is_extendable_from_iterator = requires(T& arg, It first, It last) { //
+  requires std::input_iterator<It>;
+  arg.insert(std::ranges::end(arg), first, last);
+};
+
+// NOTE: elements are exchanged with Rust as raw bytes so they must be trivially copyable
+template<typename T>
+concept is_contiguous_iterable = requires { //
+  requires is_iterable<T>;
+  requires std::ranges::contiguous_range<T>;
+  requires std::ranges::sized_range<T>;
+  requires std::is_trivially_copyable_v<std::ranges::range_value_t<T>>;
+};
+
+template<typename T>
+concept is_mutable_contiguous_iterable = is_contiguous_iterable<T> and requires(T& arg) { //
+  {
+    std::ranges::data(arg)
+  } -> std::same_as<std::ranges::range_value_t<T>*>;
+};
+
+template<typename T>
+concept is_contiguous_constructible =
+  is_contiguous_iterable<T> and is_constructible_from_iterator<T, std::ranges::range_value_t<T> const*>;
+
+template<typename T>
+concept is_contiguous_extendable =
+  is_mutable_contiguous_iterable<T> and is_extendable_from_iterator<T, std::ranges::range_value_t<T> const*>;
 } // namespace cxx_memory::abi::detection
 
 namespace cxx_memory::abi {
@@ -162,6 +196,30 @@ cxx_abi_size() noexcept -> size_t
   return sizeof(T);
 }
 
+template<typename T>
+[[nodiscard]] [[gnu::always_inline]] [[gnu::const]]
+constexpr static inline auto
+cxx_abi_value_size() noexcept -> size_t
+{
+  if constexpr (detection::is_contiguous_iterable<T>) {
+    return sizeof(std::ranges::range_value_t<T>);
+  } else {
+    return 0;
+  }
+}
+
+template<typename T>
+[[nodiscard]] [[gnu::always_inline]] [[gnu::const]]
+constexpr static inline auto
+cxx_abi_value_align() noexcept -> size_t
+{
+  if constexpr (detection::is_contiguous_iterable<T>) {
+    return alignof(std::ranges::range_value_t<T>);
+  } else {
+    return 0;
+  }
+}
+
 template<typename T, typename... Args>
 [[nodiscard]] [[gnu::always_inline]] [[gnu::const]]
 constexpr static inline auto
@@ -226,6 +284,19 @@ cxx_is_trivially_destructible() noexcept -> bool
   return std::is_trivially_destructible_v<T>;
 }
 
+// NOTE: types marked `[[clang::trivial_abi]]` are trivially relocatable without being trivially movable
+template<typename T>
+[[nodiscard]] [[gnu::always_inline]] [[gnu::const]]
+constexpr static inline auto
+cxx_is_trivially_relocatable() noexcept -> bool
+{
+#if __has_builtin(__is_trivially_relocatable)
+  return __is_trivially_relocatable(T);
+#else
+  return cxx_is_trivially_movable<T>();
+#endif
+}
+
 template<typename T>
 [[nodiscard]] [[gnu::always_inline]] [[gnu::const]]
 constexpr static inline auto
@@ -308,6 +379,55 @@ cxx_is_totally_ordered() noexcept -> bool
   return std::totally_ordered<T>;
 }
 
+template<typename T>
+[[nodiscard]] [[gnu::always_inline]] [[gnu::const]]
+constexpr static inline auto
+cxx_is_sortable() noexcept -> bool
+{
+  return cxx_is_totally_ordered<T>() and std::is_move_constructible_v<T> and std::is_move_assignable_v<T> and
+         std::is_swappable_v<T>;
+}
+
+template<typename T>
+[[nodiscard]] [[gnu::always_inline]] [[gnu::const]]
+constexpr static inline auto
+cxx_is_deduplicable() noexcept -> bool
+{
+  return cxx_has_operator_equal<T>() and std::is_move_assignable_v<T>;
+}
+
+template<typename T>
+[[nodiscard]] [[gnu::always_inline]] [[gnu::const]]
+constexpr static inline auto
+cxx_is_contiguous_range() noexcept -> bool
+{
+  return detection::is_contiguous_iterable<T>;
+}
+
+template<typename T>
+[[nodiscard]] [[gnu::always_inline]] [[gnu::const]]
+constexpr static inline auto
+cxx_is_mutable_contiguous_range() noexcept -> bool
+{
+  return detection::is_mutable_contiguous_iterable<T>;
+}
+
+template<typename T>
+[[nodiscard]] [[gnu::always_inline]] [[gnu::const]]
+constexpr static inline auto
+cxx_is_constructible_from_slice() noexcept -> bool
+{
+  return detection::is_contiguous_constructible<T>;
+}
+
+template<typename T>
+[[nodiscard]] [[gnu::always_inline]] [[gnu::const]]
+constexpr static inline auto
+cxx_is_extendable_from_slice() noexcept -> bool
+{
+  return detection::is_contiguous_extendable<T>;
+}
+
 template<typename T>
 [[nodiscard]] [[gnu::always_inline]] [[gnu::const]]
 constexpr static inline auto
@@ -333,6 +453,15 @@ cxx_is_displayable() noexcept -> bool
          detection::has_operator_std_string_view<T>;
 }
 
+template<typename T>
+[[nodiscard]] [[gnu::always_inline]] [[gnu::const]]
+constexpr static inline auto
+cxx_is_displayable_as_string_view() noexcept -> bool
+{
+  return not detection::has_to_string<T> and not detection::has_operator_std_string<T> and
+         detection::has_operator_std_string_view<T>;
+}
+
 template<typename T>
 [[nodiscard]] [[gnu::always_inline]] [[gnu::const]]
 constexpr static inline auto
@@ -349,12 +478,20 @@ rust_should_impl_unpin() noexcept -> bool
   return cxx_is_trivially_movable<T>();
 }
 
+// NOTE: C++ gives no way to check that a type has no thread affinity, so a binding opts in by specializing these before
+// expanding `CXX_MEMORY_ABI_PRELUDE`, e.g., `template<> inline constexpr bool cxx_memory::abi::cxx_is_send<T> = true;`
+template<typename T>
+inline constexpr bool cxx_is_send = false;
+
+template<typename T>
+inline constexpr bool cxx_is_sync = false;
+
 template<typename T>
 [[nodiscard]] [[gnu::always_inline]] [[gnu::const]]
 constexpr static inline auto
 rust_should_impl_send() noexcept -> bool
 {
-  return false;
+  return cxx_is_send<T>;
 }
 
 template<typename T>
@@ -362,7 +499,7 @@ template<typename T>
 constexpr static inline auto
 rust_should_impl_sync() noexcept -> bool
 {
-  return false;
+  return cxx_is_sync<T>;
 }
 
 template<typename T>
@@ -464,6 +601,86 @@ rust_should_impl_display() noexcept -> bool
 
 } // namespace cxx_memory::abi
 
+namespace cxx_memory::abi {
+// NOTE: opaque handle to the `core::fmt::Write` sink defined in `cxx-memory/src/fmt.rs`
+struct CxxFormatSink;
+} // namespace cxx_memory::abi
+
+extern "C" auto
+cxx_memory$abi$cxx_format_sink_write(::cxx_memory::abi::CxxFormatSink* sink, char const* data, size_t len) noexcept
+  -> bool;
+
+namespace cxx_memory::abi {
+// NOTE: forwards formatted output to a Rust `core::fmt::Write` sink in fixed-size chunks without allocating
+class cxx_format_streambuf final : public std::streambuf
+{
+public:
+  explicit cxx_format_streambuf(CxxFormatSink* sink) noexcept
+    : sink{ sink }
+  {
+    setp(buffer.data(), buffer.data() + buffer.size());
+  }
+
+  [[nodiscard]] auto finish() noexcept -> bool
+  {
+    return flush(true);
+  }
+
+protected:
+  auto overflow(int_type ch) -> int_type override
+  {
+    if (not flush(false)) {
+      return traits_type::eof();
+    }
+    if (not traits_type::eq_int_type(ch, traits_type::eof())) {
+      *pptr() = traits_type::to_char_type(ch);
+      pbump(1);
+    }
+    return traits_type::not_eof(ch);
+  }
+
+  auto sync() -> int override
+  {
+    return flush(false) ? 0 : -1;
+  }
+
+private:
+  // NOTE: when `complete` is false, a trailing incomplete UTF-8 sequence is kept back for the next chunk
+  auto flush(bool complete) noexcept -> bool
+  {
+    auto* first = pbase();
+    auto* last = pptr();
+    auto* end = complete ? last : utf8_boundary(first, last);
+    if (ok and first != end) {
+      ok = cxx_memory$abi$cxx_format_sink_write(sink, first, static_cast<size_t>(end - first));
+    }
+    auto carry = last - end;
+    std::memmove(first, end, static_cast<size_t>(carry));
+    setp(buffer.data(), buffer.data() + buffer.size());
+    pbump(static_cast<int>(carry));
+    return ok;
+  }
+
+  [[nodiscard]] static auto utf8_boundary(char* first, char* last) noexcept -> char*
+  {
+    auto* it = last;
+    for (auto i = 0; i < 4 and it != first; ++i) {
+      --it;
+      auto byte = static_cast<unsigned char>(*it);
+      if ((byte & 0xC0U) != 0x80U) {
+        auto width = byte >= 0xF0U ? 4 : byte >= 0xE0U ? 3 : byte >= 0xC0U ? 2 : 1;
+        return (last - it) < width ? it : last;
+      }
+    }
+    return last;
+  }
+
+  CxxFormatSink* sink;
+  bool ok = true;
+  std::array<char, 256> buffer{};
+};
+} // namespace cxx_memory::abi
+
 namespace cxx_memory::abi {
 template<typename T, typename... Args>
 requires(cxx_is_constructible<T, Args...>())
@@ -512,6 +729,69 @@ cxx_destruct(T* This [[clang::lifetimebound]]) -> void
   std::destroy_at(This);
 }
 
+template<typename T>
+requires(cxx_is_default_constructible<T>())
+[[gnu::always_inline]]
+static inline auto
+cxx_default_new_n(T* This [[clang::lifetimebound]], size_t n) noexcept -> void
+{
+  std::uninitialized_value_construct_n(This, n);
+}
+
+template<typename T>
+requires(cxx_is_copy_constructible<T>())
+[[gnu::always_inline]]
+static inline auto
+cxx_copy_new_n(T* This [[clang::lifetimebound]], T const* that [[clang::lifetimebound]], size_t n) noexcept -> void
+{
+  if constexpr (cxx_is_trivially_copyable<T>()) {
+    std::memcpy(This, that, n * sizeof(T));
+  } else {
+    std::uninitialized_copy_n(that, n, This);
+  }
+}
+
+template<typename T>
+requires(cxx_is_move_constructible<T>())
+[[gnu::always_inline]]
+static inline auto
+cxx_move_new_n(T* This [[clang::lifetimebound]], T* that [[clang::lifetimebound]], size_t n) noexcept -> void
+{
+  if constexpr (cxx_is_trivially_copyable<T>()) {
+    std::memcpy(This, that, n * sizeof(T));
+  } else {
+    std::uninitialized_move_n(that, n, This);
+  }
+}
+
+// NOTE: each element is destroyed right after it is moved from, so relocating a slice takes one pass and one call
+template<typename T>
+requires(cxx_is_move_constructible<T>() and cxx_is_destructible<T>())
+[[gnu::always_inline]]
+static inline auto
+cxx_relocate_n(T* This [[clang::lifetimebound]], T* that [[clang::lifetimebound]], size_t n) noexcept -> void
+{
+  if constexpr (cxx_is_trivially_relocatable<T>()) {
+    std::memcpy(This, that, n * sizeof(T));
+  } else {
+    for (size_t i = 0; i < n; ++i) {
+      new (This + i) T(std::move(that[i]));
+      std::destroy_at(that + i);
+    }
+  }
+}
+
+template<typename T>
+requires(cxx_is_destructible<T>())
+[[gnu::always_inline]]
+static inline auto
+cxx_destruct_n(T* This [[clang::lifetimebound]], size_t n) -> void
+{
+  if constexpr (not cxx_is_trivially_destructible<T>()) {
+    std::destroy_n(This, n);
+  }
+}
+
 template<typename T>
 requires(cxx_has_operator_equal<T>())
 [[gnu::always_inline]]
@@ -624,43 +904,153 @@ cxx_hash(T const& This [[clang::lifetimebound]]) noexcept -> size_t
   return std::hash<T>{}(This);
 }
 
+template<typename T>
+requires(cxx_is_sortable<T>())
+[[gnu::always_inline]]
+static inline auto
+cxx_sort(T* This [[clang::lifetimebound]], size_t n) noexcept -> void
+{
+  std::sort(This, This + n);
+}
+
+template<typename T>
+requires(cxx_is_sortable<T>())
+[[gnu::always_inline]]
+static inline auto
+cxx_stable_sort(T* This [[clang::lifetimebound]], size_t n) noexcept -> void
+{
+  std::stable_sort(This, This + n);
+}
+
+template<typename T>
+requires(cxx_is_totally_ordered<T>())
+[[gnu::always_inline]]
+static inline auto
+cxx_lower_bound(T const* This [[clang::lifetimebound]], size_t n, T const& value) noexcept -> size_t
+{
+  return static_cast<size_t>(std::lower_bound(This, This + n, value) - This);
+}
+
+// NOTE: elements past the returned length are left in a valid but unspecified (moved-from) state
+template<typename T>
+requires(cxx_is_deduplicable<T>())
+[[gnu::always_inline]]
+static inline auto
+cxx_unique(T* This [[clang::lifetimebound]], size_t n) noexcept -> size_t
+{
+  return static_cast<size_t>(std::unique(This, This + n) - This);
+}
+
 template<typename T>
 requires(detection::has_operator_ostream_left_shift<T>)
 [[gnu::always_inline]]
 static inline auto
-cxx_debug(T const& This [[clang::lifetimebound]]) noexcept -> rust::String
+cxx_debug(T const& This [[clang::lifetimebound]], CxxFormatSink* sink) noexcept -> bool
 {
-  std::ostringstream os;
+  cxx_format_streambuf buf{ sink };
+  std::ostream os{ &buf };
   os << This;
-  return rust::String::lossy(os.str());
+  return buf.finish();
 }
 
 template<typename T>
 requires(detection::has_to_string<T>)
 [[gnu::always_inline]]
 static inline auto
-cxx_display(T const& This [[clang::lifetimebound]]) noexcept -> rust::String
+cxx_display(T const& This [[clang::lifetimebound]], CxxFormatSink* sink) noexcept -> bool
 {
-  return rust::String::lossy(std::to_string(This));
+  auto string = std::to_string(This);
+  return cxx_memory$abi$cxx_format_sink_write(sink, string.data(), string.size());
 }
 
 template<typename T>
 requires(not detection::has_to_string<T> and detection::has_operator_std_string<T>)
 [[gnu::always_inline]]
 static inline auto
-cxx_display(T const& This [[clang::lifetimebound]]) noexcept -> rust::String
+cxx_display(T const& This [[clang::lifetimebound]], CxxFormatSink* sink) noexcept -> bool
 {
-  return rust::String::lossy(This.operator std::string());
+  auto string = This.operator std::string();
+  return cxx_memory$abi$cxx_format_sink_write(sink, string.data(), string.size());
 }
 
-// FIXME: optimize this to use `&str` instead of `String`
 template<typename T>
 requires(not detection::has_to_string<T> and not detection::has_operator_std_string<T> and detection::has_operator_std_string_view<T>)
 [[gnu::always_inline]]
 static inline auto
-cxx_display(T const& This [[clang::lifetimebound]]) noexcept -> rust::String
+cxx_display(T const& This [[clang::lifetimebound]], CxxFormatSink* sink) noexcept -> bool
+{
+  auto view = This.operator std::string_view();
+  return cxx_memory$abi$cxx_format_sink_write(sink, view.data(), view.size());
+}
+
+template<typename T>
+requires(cxx_is_displayable_as_string_view<T>())
+[[gnu::always_inline]]
+static inline auto
+cxx_display_bytes(T const& This [[clang::lifetimebound]]) noexcept -> rust::Slice<uint8_t const>
+{
+  auto view = This.operator std::string_view();
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  return rust::Slice<uint8_t const>{ reinterpret_cast<uint8_t const*>(view.data()), view.size() };
+}
+
+template<typename T>
+requires(cxx_is_contiguous_range<T>())
+[[gnu::always_inline]]
+static inline auto
+cxx_as_bytes(T const& This [[clang::lifetimebound]]) noexcept -> rust::Slice<uint8_t const>
+{
+  auto const size = std::ranges::size(This);
+  if (size == 0) {
+    return {};
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  auto const* data = reinterpret_cast<uint8_t const*>(std::ranges::data(This));
+  return rust::Slice<uint8_t const>{ data, size * sizeof(std::ranges::range_value_t<T>) };
+}
+
+template<typename T>
+requires(cxx_is_mutable_contiguous_range<T>())
+[[gnu::always_inline]]
+static inline auto
+cxx_as_mut_bytes(T& This [[clang::lifetimebound]]) noexcept -> rust::Slice<uint8_t>
+{
+  auto const size = std::ranges::size(This);
+  if (size == 0) {
+    return {};
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  auto* data = reinterpret_cast<uint8_t*>(std::ranges::data(This));
+  return rust::Slice<uint8_t>{ data, size * sizeof(std::ranges::range_value_t<T>) };
+}
+
+template<typename T>
+requires(cxx_is_constructible_from_slice<T>())
+[[gnu::always_inline]]
+static inline auto
+cxx_new_from_bytes(T* This, rust::Slice<uint8_t const> bytes) noexcept -> void
+{
+  using V = std::ranges::range_value_t<T>;
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  auto const* first = bytes.empty() ? nullptr : reinterpret_cast<V const*>(bytes.data());
+  auto const* last = first == nullptr ? nullptr : first + bytes.size() / sizeof(V);
+  // NOTE: not `T{ first, last }`, which picks an `std::initializer_list` constructor for pointer element types
+  new (This) T(first, last);
+}
+
+template<typename T>
+requires(cxx_is_extendable_from_slice<T>())
+[[gnu::always_inline]]
+static inline auto
+cxx_extend_from_bytes(T& This, rust::Slice<uint8_t const> bytes) noexcept -> void
 {
-  return rust::String::lossy(std::string{ This.operator std::string_view() });
+  using V = std::ranges::range_value_t<T>;
+  if (bytes.empty()) {
+    return;
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  auto const* first = reinterpret_cast<V const*>(bytes.data());
+  This.insert(std::ranges::end(This), first, first + bytes.size() / sizeof(V));
 }
 
 }; // namespace cxx_memory::abi
@@ -730,6 +1120,18 @@ cxx_display(T const& This [[clang::lifetimebound]]) noexcept -> rust::String
   }                                                                                                                    \
                                                                                                                        \
   [[nodiscard]] [[gnu::always_inline]] [[gnu::const]]                                                                  \
+  constexpr static inline auto cxx_abi_value_size() noexcept -> size_t                                                 \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_abi_value_size<Self>();                                                              \
+  }                                                                                                                    \
+                                                                                                                       \
+  [[nodiscard]] [[gnu::always_inline]] [[gnu::const]]                                                                  \
+  constexpr static inline auto cxx_abi_value_align() noexcept -> size_t                                                \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_abi_value_align<Self>();                                                             \
+  }                                                                                                                    \
+                                                                                                                       \
+  [[nodiscard]] [[gnu::always_inline]] [[gnu::const]]                                                                  \
   constexpr static inline auto cxx_is_default_constructible() noexcept -> bool                                         \
   {                                                                                                                    \
     return ::cxx_memory::abi::cxx_is_default_constructible<Self>();                                                    \
@@ -772,6 +1174,12 @@ cxx_display(T const& This [[clang::lifetimebound]]) noexcept -> rust::String
   }                                                                                                                    \
                                                                                                                        \
   [[nodiscard]] [[gnu::always_inline]] [[gnu::const]]                                                                  \
+  constexpr static inline auto cxx_is_trivially_relocatable() noexcept -> bool                                         \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_is_trivially_relocatable<Self>();                                                    \
+  }                                                                                                                    \
+                                                                                                                       \
+  [[nodiscard]] [[gnu::always_inline]] [[gnu::const]]                                                                  \
   constexpr static inline auto cxx_is_equality_comparable() noexcept -> bool                                           \
   {                                                                                                                    \
     return ::cxx_memory::abi::cxx_is_equality_comparable<Self>();                                                      \
@@ -832,6 +1240,42 @@ cxx_display(T const& This [[clang::lifetimebound]]) noexcept -> rust::String
   }                                                                                                                    \
                                                                                                                        \
   [[nodiscard]] [[gnu::always_inline]] [[gnu::const]]                                                                  \
+  constexpr static inline auto cxx_is_sortable() noexcept -> bool                                                      \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_is_sortable<Self>();                                                                 \
+  }                                                                                                                    \
+                                                                                                                       \
+  [[nodiscard]] [[gnu::always_inline]] [[gnu::const]]                                                                  \
+  constexpr static inline auto cxx_is_deduplicable() noexcept -> bool                                                  \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_is_deduplicable<Self>();                                                             \
+  }                                                                                                                    \
+                                                                                                                       \
+  [[nodiscard]] [[gnu::always_inline]] [[gnu::const]]                                                                  \
+  constexpr static inline auto cxx_is_contiguous_range() noexcept -> bool                                              \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_is_contiguous_range<Self>();                                                         \
+  }                                                                                                                    \
+                                                                                                                       \
+  [[nodiscard]] [[gnu::always_inline]] [[gnu::const]]                                                                  \
+  constexpr static inline auto cxx_is_mutable_contiguous_range() noexcept -> bool                                      \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_is_mutable_contiguous_range<Self>();                                                 \
+  }                                                                                                                    \
+                                                                                                                       \
+  [[nodiscard]] [[gnu::always_inline]] [[gnu::const]]                                                                  \
+  constexpr static inline auto cxx_is_constructible_from_slice() noexcept -> bool                                      \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_is_constructible_from_slice<Self>();                                                 \
+  }                                                                                                                    \
+                                                                                                                       \
+  [[nodiscard]] [[gnu::always_inline]] [[gnu::const]]                                                                  \
+  constexpr static inline auto cxx_is_extendable_from_slice() noexcept -> bool                                         \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_is_extendable_from_slice<Self>();                                                    \
+  }                                                                                                                    \
+                                                                                                                       \
+  [[nodiscard]] [[gnu::always_inline]] [[gnu::const]]                                                                  \
   constexpr static inline auto cxx_is_hashable() noexcept -> bool                                                      \
   {                                                                                                                    \
     return ::cxx_memory::abi::cxx_is_hashable<Self>();                                                                 \
@@ -850,6 +1294,12 @@ cxx_display(T const& This [[clang::lifetimebound]]) noexcept -> rust::String
   }                                                                                                                    \
                                                                                                                        \
   [[nodiscard]] [[gnu::always_inline]] [[gnu::const]]                                                                  \
+  constexpr static inline auto cxx_is_displayable_as_string_view() noexcept -> bool                                    \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_is_displayable_as_string_view<Self>();                                               \
+  }                                                                                                                    \
+                                                                                                                       \
+  [[nodiscard]] [[gnu::always_inline]] [[gnu::const]]                                                                  \
   constexpr static inline auto rust_should_impl_cxx_extern_type_trivial() noexcept -> bool                             \
   {                                                                                                                    \
     return ::cxx_memory::abi::rust_should_impl_cxx_extern_type_trivial<Self>();                                        \
@@ -980,6 +1430,55 @@ cxx_display(T const& This [[clang::lifetimebound]]) noexcept -> rust::String
   }                                                                                                                    \
                                                                                                                        \
   template<typename T>                                                                                                 \
+  requires(::std::same_as<T, Self> and ::cxx_memory::abi::cxx_is_default_constructible<T>())                           \
+  [[gnu::always_inline]]                                                                                               \
+  static inline auto cxx_default_new_n(T* This [[clang::lifetimebound]], size_t n) noexcept -> void                    \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_default_new_n(This, n);                                                              \
+  }                                                                                                                    \
+                                                                                                                       \
+  template<typename T>                                                                                                 \
+  requires(::std::same_as<T, Self> and ::cxx_memory::abi::cxx_is_copy_constructible<T>())                              \
+  [[gnu::always_inline]]                                                                                               \
+  static inline auto cxx_copy_new_n(                                                                                   \
+    T* This [[clang::lifetimebound]], T const* that [[clang::lifetimebound]], size_t n                                 \
+  ) noexcept -> void                                                                                                   \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_copy_new_n(This, that, n);                                                           \
+  }                                                                                                                    \
+                                                                                                                       \
+  template<typename T>                                                                                                 \
+  requires(::std::same_as<T, Self> and ::cxx_memory::abi::cxx_is_move_constructible<T>())                              \
+  [[gnu::always_inline]]                                                                                               \
+  static inline auto cxx_move_new_n(                                                                                   \
+    T* This [[clang::lifetimebound]], T* that [[clang::lifetimebound]], size_t n                                       \
+  ) noexcept -> void                                                                                                   \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_move_new_n(This, that, n);                                                           \
+  }                                                                                                                    \
+                                                                                                                       \
+  template<typename T>                                                                                                 \
+  requires(                                                                                                            \
+    ::std::same_as<T, Self> and ::cxx_memory::abi::cxx_is_move_constructible<T>() and                                  \
+    ::cxx_memory::abi::cxx_is_destructible<T>()                                                                        \
+  )                                                                                                                    \
+  [[gnu::always_inline]]                                                                                               \
+  static inline auto cxx_relocate_n(                                                                                   \
+    T* This [[clang::lifetimebound]], T* that [[clang::lifetimebound]], size_t n                                       \
+  ) noexcept -> void                                                                                                   \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_relocate_n(This, that, n);                                                           \
+  }                                                                                                                    \
+                                                                                                                       \
+  template<typename T>                                                                                                 \
+  requires(::std::same_as<T, Self> and ::cxx_memory::abi::cxx_is_destructible<T>())                                    \
+  [[gnu::always_inline]]                                                                                               \
+  static inline auto cxx_destruct_n(T* This [[clang::lifetimebound]], size_t n) noexcept -> void                       \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_destruct_n(This, n);                                                                 \
+  }                                                                                                                    \
+                                                                                                                       \
+  template<typename T>                                                                                                 \
   requires(::std::same_as<T, Self> and ::cxx_memory::abi::cxx_has_operator_equal<T>())                                 \
   [[gnu::always_inline]]                                                                                               \
   static inline auto cxx_operator_equal(                                                                               \
@@ -1058,19 +1557,97 @@ cxx_display(T const& This [[clang::lifetimebound]]) noexcept -> rust::String
   }                                                                                                                    \
                                                                                                                        \
   template<typename T>                                                                                                 \
+  requires(::std::same_as<T, Self> and ::cxx_memory::abi::cxx_is_sortable<T>())                                        \
+  [[gnu::always_inline]]                                                                                               \
+  static inline auto cxx_sort(T* This [[clang::lifetimebound]], size_t n) noexcept -> void                             \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_sort(This, n);                                                                       \
+  }                                                                                                                    \
+                                                                                                                       \
+  template<typename T>                                                                                                 \
+  requires(::std::same_as<T, Self> and ::cxx_memory::abi::cxx_is_sortable<T>())                                        \
+  [[gnu::always_inline]]                                                                                               \
+  static inline auto cxx_stable_sort(T* This [[clang::lifetimebound]], size_t n) noexcept -> void                      \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_stable_sort(This, n);                                                                \
+  }                                                                                                                    \
+                                                                                                                       \
+  template<typename T>                                                                                                 \
+  requires(::std::same_as<T, Self> and ::cxx_memory::abi::cxx_is_totally_ordered<T>())                                 \
+  [[gnu::always_inline]]                                                                                               \
+  static inline auto cxx_lower_bound(T const* This [[clang::lifetimebound]], size_t n, T const& value) noexcept        \
+    -> size_t                                                                                                          \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_lower_bound(This, n, value);                                                         \
+  }                                                                                                                    \
+                                                                                                                       \
+  template<typename T>                                                                                                 \
+  requires(::std::same_as<T, Self> and ::cxx_memory::abi::cxx_is_deduplicable<T>())                                    \
+  [[gnu::always_inline]]                                                                                               \
+  static inline auto cxx_unique(T* This [[clang::lifetimebound]], size_t n) noexcept -> size_t                         \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_unique(This, n);                                                                     \
+  }                                                                                                                    \
+                                                                                                                       \
+  template<typename T>                                                                                                 \
   requires(::std::same_as<T, Self> and ::cxx_memory::abi::cxx_is_debuggable<T>())                                      \
   [[gnu::always_inline]]                                                                                               \
-  static inline auto cxx_debug(T const& This [[clang::lifetimebound]]) noexcept -> rust::string                        \
+  static inline auto cxx_debug(                                                                                        \
+    T const& This [[clang::lifetimebound]], ::cxx_memory::abi::CxxFormatSink* sink                                     \
+  ) noexcept -> bool                                                                                                   \
   {                                                                                                                    \
-    return ::cxx_memory::abi::cxx_debug(This);                                                                         \
+    return ::cxx_memory::abi::cxx_debug(This, sink);                                                                   \
   }                                                                                                                    \
                                                                                                                        \
   template<typename T>                                                                                                 \
   requires(::std::same_as<T, Self> and ::cxx_memory::abi::cxx_is_displayable<T>())                                     \
   [[gnu::always_inline]]                                                                                               \
-  static inline auto cxx_display(T const& This [[clang::lifetimebound]]) noexcept -> rust::string                      \
+  static inline auto cxx_display(                                                                                      \
+    T const& This [[clang::lifetimebound]], ::cxx_memory::abi::CxxFormatSink* sink                                     \
+  ) noexcept -> bool                                                                                                   \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_display(This, sink);                                                                 \
+  }                                                                                                                    \
+                                                                                                                       \
+  template<typename T>                                                                                                 \
+  requires(::std::same_as<T, Self> and ::cxx_memory::abi::cxx_is_displayable_as_string_view<T>())                      \
+  [[gnu::always_inline]]                                                                                               \
+  static inline auto cxx_display_bytes(T const& This [[clang::lifetimebound]]) noexcept                                \
+    -> ::rust::Slice<uint8_t const>                                                                                    \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_display_bytes(This);                                                                 \
+  }                                                                                                                    \
+                                                                                                                       \
+  template<typename T>                                                                                                 \
+  requires(::std::same_as<T, Self> and ::cxx_memory::abi::cxx_is_contiguous_range<T>())                                \
+  [[gnu::always_inline]]                                                                                               \
+  static inline auto cxx_as_bytes(T const& This [[clang::lifetimebound]]) noexcept -> ::rust::Slice<uint8_t const>     \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_as_bytes(This);                                                                      \
+  }                                                                                                                    \
+                                                                                                                       \
+  template<typename T>                                                                                                 \
+  requires(::std::same_as<T, Self> and ::cxx_memory::abi::cxx_is_mutable_contiguous_range<T>())                        \
+  [[gnu::always_inline]]                                                                                               \
+  static inline auto cxx_as_mut_bytes(T& This [[clang::lifetimebound]]) noexcept -> ::rust::Slice<uint8_t>             \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_as_mut_bytes(This);                                                                  \
+  }                                                                                                                    \
+                                                                                                                       \
+  template<typename T>                                                                                                 \
+  requires(::std::same_as<T, Self> and ::cxx_memory::abi::cxx_is_constructible_from_slice<T>())                        \
+  [[gnu::always_inline]]                                                                                               \
+  static inline auto cxx_new_from_bytes(T* This, ::rust::Slice<uint8_t const> bytes) noexcept -> void                  \
+  {                                                                                                                    \
+    return ::cxx_memory::abi::cxx_new_from_bytes(This, bytes);                                                         \
+  }                                                                                                                    \
+                                                                                                                       \
+  template<typename T>                                                                                                 \
+  requires(::std::same_as<T, Self> and ::cxx_memory::abi::cxx_is_extendable_from_slice<T>())                           \
+  [[gnu::always_inline]]                                                                                               \
+  static inline auto cxx_extend_from_bytes(T& This, ::rust::Slice<uint8_t const> bytes) noexcept -> void               \
   {                                                                                                                    \
-    return ::cxx_memory::abi::cxx_display(This);                                                                       \
+    return ::cxx_memory::abi::cxx_extend_from_bytes(This, bytes);                                                      \
   }
 
 // NOLINTEND(cppcoreguidelines-macro-usage, bugprone-macro-parentheses)
@@ -0,0 +1,128 @@
+#include "cxx-memory-abi/cxx/include/cxx-memory-abi.hxx"
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// NOTE: stands in for the Rust `CxxFormatSink`, recording each chunk that `cxx_format_streambuf` writes
+struct cxx_memory::abi::CxxFormatSink
+{
+  std::vector<std::string> chunks;
+  bool fail = false;
+};
+
+extern "C" auto
+cxx_memory$abi$cxx_format_sink_write(::cxx_memory::abi::CxxFormatSink* sink, char const* data, size_t len) noexcept
+  -> bool
+{
+  sink->chunks.emplace_back(data, len);
+  return not sink->fail;
+}
+
+namespace {
+struct text
+{
+  std::string_view value;
+};
+
+auto
+operator<<(std::ostream& os, text const& value) -> std::ostream&
+{
+  return os << value.value;
+}
+
+auto failures = 0;
+
+auto
+check(bool ok, char const* what, std::string_view input) -> void
+{
+  if (not ok) {
+    std::fprintf(stderr, "FAILED: %s (input of %zu bytes)\n", what, input.size());
+    ++failures;
+  }
+}
+
+// NOTE: whether `chunk` ends with a complete UTF-8 sequence, so that the stateless Rust sink can decode it on its own
+auto
+ends_on_boundary(std::string_view chunk) -> bool
+{
+  for (size_t i = 0; i < 4 and i < chunk.size(); ++i) {
+    auto byte = static_cast<unsigned char>(chunk[chunk.size() - 1 - i]);
+    if ((byte & 0xC0U) != 0x80U) {
+      auto width = byte >= 0xF0U ? 4U : byte >= 0xE0U ? 3U : byte >= 0xC0U ? 2U : 1U;
+      return i + 1 == width;
+    }
+  }
+  return chunk.empty();
+}
+
+auto
+debug(std::string_view input, bool fail = false) -> std::pair<bool, ::cxx_memory::abi::CxxFormatSink>
+{
+  ::cxx_memory::abi::CxxFormatSink sink{ .chunks = {}, .fail = fail };
+  auto ok = ::cxx_memory::abi::cxx_debug(text{ input }, &sink);
+  return { ok, std::move(sink) };
+}
+
+auto
+joined(::cxx_memory::abi::CxxFormatSink const& sink) -> std::string
+{
+  std::string out;
+  for (auto const& chunk : sink.chunks) {
+    out += chunk;
+  }
+  return out;
+}
+
+auto
+test_keeps_sequences_split_across_chunks() -> void
+{
+  for (std::string_view ch : { "a", "é", "€", "\U0001F496" }) {
+    for (size_t offset = 0; offset < ch.size(); ++offset) {
+      std::string input(256 - offset, 'x');
+      for (auto i = 0; i < 200; ++i) {
+        input += ch;
+      }
+      auto [ok, sink] = debug(input);
+      check(ok, "cxx_debug succeeds", input);
+      check(joined(sink) == input, "chunks join to the input", input);
+      check(sink.chunks.size() > 1, "output is written in more than one chunk", input);
+      for (auto const& chunk : sink.chunks) {
+        check(chunk.size() <= 256, "chunks fit the buffer", input);
+        check(ends_on_boundary(chunk), "chunks end on a UTF-8 boundary", input);
+      }
+    }
+  }
+}
+
+// NOTE: an invalid sequence cannot be completed, so it is passed through for the sink to replace
+auto
+test_passes_invalid_sequences_through() -> void
+{
+  std::string input(255, 'x');
+  input += "\xE2\x82yz";
+  auto [ok, sink] = debug(input);
+  check(ok, "cxx_debug succeeds", input);
+  check(joined(sink) == input, "chunks join to the input", input);
+  check(sink.chunks.size() == 2 and sink.chunks[1] == "\xE2\x82yz", "the incomplete sequence is carried over", input);
+}
+
+auto
+test_reports_sink_errors() -> void
+{
+  std::string input(1000, 'x');
+  auto [ok, sink] = debug(input, true);
+  check(not ok, "cxx_debug fails when the sink fails", input);
+  check(sink.chunks.size() == 1, "nothing is written after the sink fails", input);
+}
+} // namespace
+
+auto
+main() -> int
+{
+  test_keeps_sequences_split_across_chunks();
+  test_passes_invalid_sequences_through();
+  test_reports_sink_errors();
+  return failures == 0 ? 0 : 1;
+}
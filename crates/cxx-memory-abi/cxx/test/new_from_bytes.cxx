@@ -0,0 +1,76 @@
+#include "cxx-memory-abi/cxx/include/cxx-memory-abi.hxx"
+
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+auto failures = 0;
+
+auto
+check(bool ok, char const* what) -> void
+{
+  if (not ok) {
+    std::fprintf(stderr, "FAILED: %s\n", what);
+    ++failures;
+  }
+}
+
+template<typename V>
+auto
+bytes_of(std::vector<V> const& values) -> rust::Slice<uint8_t const>
+{
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  return { reinterpret_cast<uint8_t const*>(values.data()), values.size() * sizeof(V) };
+}
+
+template<typename T, typename V>
+auto
+new_from_bytes(std::vector<V> const& values) -> T
+{
+  alignas(T) std::byte storage[sizeof(T)];
+  auto* This = reinterpret_cast<T*>(storage); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+  ::cxx_memory::abi::cxx_new_from_bytes(This, bytes_of(values));
+  auto value = std::move(*This);
+  std::destroy_at(This);
+  return value;
+}
+
+// NOTE: any object pointer converts to `void const*`, so braces would construct a vector of the two iterators instead
+auto
+test_pointer_elements() -> void
+{
+  int a = 0;
+  int b = 0;
+  int c = 0;
+  std::vector<void const*> values{ &a, &b, &c };
+  static_assert(::cxx_memory::abi::cxx_is_constructible_from_slice<std::vector<void const*>>());
+  check(new_from_bytes<std::vector<void const*>>(values) == values, "pointer elements are copied");
+  check(new_from_bytes<std::vector<void const*>>(std::vector<void const*>{ &a, &b }).size() == 2,
+        "two pointer elements are not taken as an iterator pair");
+}
+
+auto
+test_value_elements() -> void
+{
+  std::vector<int> values{ 1, 2, 3 };
+  check(new_from_bytes<std::vector<int>>(values) == values, "int elements are copied");
+  check(new_from_bytes<std::string>(std::vector<char>{ 'a', 'b' }) == "ab", "chars are copied");
+}
+
+auto
+test_empty() -> void
+{
+  check(new_from_bytes<std::vector<void const*>>(std::vector<void const*>{}).empty(), "no elements");
+}
+} // namespace
+
+auto
+main() -> int
+{
+  test_pointer_elements();
+  test_value_elements();
+  test_empty();
+  return failures == 0 ? 0 : 1;
+}
@@ -2,6 +2,7 @@ use proc_macro2::Span;
 use syn::punctuated::Punctuated;
 
 #[cfg(feature = "alloc")]
+#[derive(Debug)]
 pub struct CxxAbiArtifactInfo {
     pub path_components: ::alloc::vec::Vec<&'static str>,
     pub path_descendants: ::alloc::vec::Vec<&'static str>,
@@ -9,15 +10,28 @@ pub struct CxxAbiArtifactInfo {
     pub cxx_namespace: &'static str,
     pub cxx_name: &'static str,
     pub rust_name: &'static str,
+    pub rust_value_type: Option<&'static str>,
     pub lifetimes: ::indexmap::IndexMap<&'static str, ::alloc::vec::Vec<&'static str>>,
     pub align: usize,
     pub size: usize,
+    pub value_size: usize,
+    pub value_align: usize,
     pub cxx_has_operator_equal: bool,
     pub cxx_has_operator_not_equal: bool,
     pub cxx_has_operator_less_than: bool,
     pub cxx_has_operator_less_than_or_equal: bool,
     pub cxx_has_operator_greater_than: bool,
     pub cxx_has_operator_greater_than_or_equal: bool,
+    pub cxx_is_trivially_copyable: bool,
+    pub cxx_is_trivially_destructible: bool,
+    pub cxx_is_trivially_relocatable: bool,
+    pub cxx_is_displayable_as_string_view: bool,
+    pub cxx_is_sortable: bool,
+    pub cxx_is_deduplicable: bool,
+    pub cxx_is_contiguous_range: bool,
+    pub cxx_is_mutable_contiguous_range: bool,
+    pub cxx_is_constructible_from_slice: bool,
+    pub cxx_is_extendable_from_slice: bool,
     pub is_rust_cxx_extern_type_trivial: bool,
     pub is_rust_unpin: bool,
     pub is_rust_send: bool,
@@ -50,7 +64,10 @@ impl CxxAbiArtifactInfo {
         let path_descendants = self.path_descendants.iter().map(|name| syn::Ident::new(name, span));
         let item_struct = emit_struct(self, align, size, ident, generics_binder, generics);
         let item_impl_cxx_extern_type = emit_impl_cxx_extern_type(self, ident, generics_binder, generics);
+        let item_impl_sync = emit_impl_sync(self, ident, generics_binder, generics);
+        let items_stats = emit_items_stats(self);
         let item_impl_drop = emit_impl_drop(self, ident, generics_binder, generics);
+        let item_impl_destruct = emit_impl_destruct(self, ident, generics_binder, generics);
         let item_impl_debug = emit_impl_debug(self, ident, generics_binder, generics);
         let item_impl_default = emit_impl_default(self, ident, generics_binder, generics);
         let item_impl_display = emit_impl_display(self, ident, generics_binder, generics);
@@ -61,6 +78,8 @@ impl CxxAbiArtifactInfo {
         let item_impl_partial_ord = emit_impl_partial_ord(self, ident, generics_binder, generics);
         let item_impl_ord = emit_impl_ord(self, ident, generics_binder, generics);
         let item_impl_hash = emit_impl_hash(self, ident, generics_binder, generics);
+        let item_impl_slice_algorithms = emit_impl_slice_algorithms(self, ident, generics_binder, generics);
+        let items_contiguous_range = emit_items_contiguous_range(self, ident, generics_binder, generics);
         let item_mod_cxx_bridge = emit_item_mod_cxx_bridge(self, ident, generics);
         let item_info_test_module = emit_info_test_module(self, ident, align, size);
         syn::parse_quote! {
@@ -68,7 +87,10 @@ impl CxxAbiArtifactInfo {
             #(pub(crate) mod #path_descendants;)*
             #item_struct
             #item_impl_cxx_extern_type
+            #item_impl_sync
+            #(#items_stats)*
             #item_impl_drop
+            #item_impl_destruct
             #item_impl_default
             #item_impl_moveit_copy_new
             #item_impl_moveit_move_new
@@ -77,6 +99,8 @@ impl CxxAbiArtifactInfo {
             #item_impl_partial_ord
             #item_impl_ord
             #item_impl_hash
+            #item_impl_slice_algorithms
+            #(#items_contiguous_range)*
             #item_impl_debug
             #item_impl_display
             #item_mod_cxx_bridge
@@ -84,46 +108,40 @@ impl CxxAbiArtifactInfo {
         }
     }
 
-    #[cfg(feature = "std")]
-    pub fn write_module_for_dir(path_components: &[&str], path_descendants: &[&str]) -> crate::BoxResult<()> {
-        use quote::ToTokens;
-        use rust_format::Formatter;
-        let abi_out_dir_root = std::path::Path::new("src/abi");
-        let abi_out_dir = abi_out_dir_root.join(std::path::PathBuf::from_iter(path_components));
-        if let Some(parent) = abi_out_dir.parent() {
-            std::fs::create_dir_all(parent)?;
+    fn is_rust_copy_new_trivial(&self) -> bool {
+        self.is_rust_copy_new && self.cxx_is_trivially_copyable
+    }
+
+    fn is_rust_move_new_trivial(&self) -> bool {
+        self.is_rust_move_new && self.cxx_is_trivially_relocatable
+    }
+
+    // NOTE: slice views need the Rust element type, which can only be given by the ABI entry
+    fn rust_value_type(&self) -> Option<syn::Type> {
+        if self.cxx_is_contiguous_range {
+            self.rust_value_type.and_then(|ty| syn::parse_str(ty).ok())
+        } else {
+            None
         }
-        let path = abi_out_dir.with_extension("rs");
-        let file: syn::File = {
-            let span = Span::call_site();
-            let path_descendants = path_descendants
-                .iter()
-                .map(|descendant| syn::Ident::new(descendant, span));
-            syn::parse_quote! {
-                //! NOTE: This module is auto-generated and should not be edited.
-                #(pub(crate) mod #path_descendants;)*
-            }
-        };
-        let tokens = file.to_token_stream();
-        let contents = rust_format::RustFmt::default().format_tokens(tokens)?;
-        std::fs::write(path, contents)?;
-        Ok(())
-    }
-
-    pub fn write_module_for_file(&self) -> crate::BoxResult<()> {
-        use quote::ToTokens;
-        use rust_format::Formatter;
-        let abi_out_dir_root = std::path::Path::new("src/abi");
-        let abi_out_dir = abi_out_dir_root.join(std::path::PathBuf::from_iter(&self.path_components));
-        if let Some(parent) = abi_out_dir.parent() {
-            std::fs::create_dir_all(parent)?;
+    }
+
+    // NOTE: the path of the generated module, relative to the `src` directory of the crate being generated
+    #[cfg(feature = "std")]
+    pub fn module_path<P: AsRef<std::path::Path>>(path_components: &[P]) -> std::path::PathBuf {
+        std::path::Path::new("abi")
+            .join(std::path::PathBuf::from_iter(path_components))
+            .with_extension("rs")
+    }
+
+    pub fn emit_file_for_dir(path_descendants: &[&str]) -> syn::File {
+        let span = Span::call_site();
+        let path_descendants = path_descendants
+            .iter()
+            .map(|descendant| syn::Ident::new(descendant, span));
+        syn::parse_quote! {
+            //! NOTE: This module is auto-generated and should not be edited.
+            #(pub(crate) mod #path_descendants;)*
         }
-        let path = abi_out_dir.with_extension("rs");
-        let file = self.emit_file();
-        let tokens = file.to_token_stream();
-        let contents = rust_format::RustFmt::default().format_tokens(tokens)?;
-        std::fs::write(path, contents)?;
-        Ok(())
     }
 }
 
@@ -138,14 +156,14 @@ fn emit_struct(
 ) -> syn::ItemStruct {
     let attribute = emit_derive_attribute(info);
     let field_layout = field_layout(size);
-    let field_neither_send_nor_sync = field_neither_send_nor_sync(info);
+    let field_send_sync = field_send_sync(info);
     let field_pinned = field_pinned(info);
     let field_lifetimes = field_lifetimes(generics);
     let fields = syn::FieldsNamed {
         brace_token: syn::token::Brace::default(),
         named: ::alloc::vec![
             Some(field_layout),
-            field_neither_send_nor_sync,
+            field_send_sync,
             field_pinned,
             field_lifetimes,
         ]
@@ -249,6 +267,70 @@ fn emit_impl_cxx_extern_type(
     }
 }
 
+#[cfg(feature = "alloc")]
+fn emit_impl_sync(
+    info: &CxxAbiArtifactInfo,
+    ident: &syn::Ident,
+    generics_binder: &syn::Generics,
+    generics: &syn::Generics,
+) -> Option<syn::ItemImpl> {
+    if info.is_rust_sync && !info.is_rust_send {
+        Some(syn::parse_quote! {
+            unsafe impl #generics_binder ::core::marker::Sync for #ident #generics {}
+        })
+    } else {
+        None
+    }
+}
+
+// NOTE: the generated impls route their FFI calls through `cxx_abi_record`, which only counts them when the consuming
+// crate enables its `cxx-abi-stats` feature and is otherwise an inlined call of the closure. In that case `CxxAbiOp` is
+// a local stand-in for `cxx_memory::stats::CxxAbiOp` with the same variants, so nothing from `stats` is referenced.
+#[cfg(feature = "alloc")]
+fn emit_items_stats(info: &CxxAbiArtifactInfo) -> [syn::Item; 5] {
+    let rust_name = info.rust_name;
+    [
+        syn::parse_quote! {
+            #[cfg(feature = "cxx-abi-stats")]
+            use ::cxx_memory::stats::CxxAbiOp;
+        },
+        syn::parse_quote! {
+            #[cfg(feature = "cxx-abi-stats")]
+            static CXX_ABI_STATS: ::cxx_memory::stats::CxxAbiStats = ::cxx_memory::stats::CxxAbiStats::new(#rust_name);
+        },
+        syn::parse_quote! {
+            #[cfg(feature = "cxx-abi-stats")]
+            #[allow(dead_code)]
+            #[inline(always)]
+            fn cxx_abi_record<R>(op: CxxAbiOp, f: impl FnOnce() -> R) -> R {
+                self::CXX_ABI_STATS.record(op, f)
+            }
+        },
+        syn::parse_quote! {
+            #[cfg(not(feature = "cxx-abi-stats"))]
+            #[allow(dead_code)]
+            enum CxxAbiOp {
+                CopyNew,
+                MoveNew,
+                Destruct,
+                Eq,
+                Cmp,
+                Hash,
+                Debug,
+                Display,
+            }
+        },
+        syn::parse_quote! {
+            #[cfg(not(feature = "cxx-abi-stats"))]
+            #[allow(dead_code)]
+            #[inline(always)]
+            fn cxx_abi_record<R>(_: CxxAbiOp, f: impl FnOnce() -> R) -> R {
+                f()
+            }
+        },
+    ]
+}
+
 #[cfg(feature = "alloc")]
 fn emit_impl_drop(
     info: &CxxAbiArtifactInfo,
@@ -256,15 +338,15 @@ fn emit_impl_drop(
     generics_binder: &syn::Generics,
     generics: &syn::Generics,
 ) -> Option<syn::ItemImpl> {
-    if info.is_rust_drop {
+    if info.is_rust_drop && !info.cxx_is_trivially_destructible {
         Some(syn::parse_quote! {
             impl #generics_binder ::core::ops::Drop for #ident #generics {
                 #[cfg_attr(feature = "tracing", tracing::instrument)]
                 #[inline]
                 fn drop(&mut self) {
-                    unsafe {
+                    self::cxx_abi_record(CxxAbiOp::Destruct, || unsafe {
                         self::ffi::cxx_destruct(self);
-                    }
+                    })
                 }
             }
         })
@@ -273,6 +355,34 @@ fn emit_impl_drop(
     }
 }
 
+// NOTE: lets `cxx_memory::destruct::{boxed_slice, vec}` destroy a whole slice with one call across the bridge
+#[cfg(feature = "alloc")]
+fn emit_impl_destruct(
+    info: &CxxAbiArtifactInfo,
+    ident: &syn::Ident,
+    generics_binder: &syn::Generics,
+    generics: &syn::Generics,
+) -> syn::ItemImpl {
+    if info.is_rust_drop && !info.cxx_is_trivially_destructible {
+        syn::parse_quote! {
+            unsafe impl #generics_binder ::cxx_memory::Destruct for #ident #generics {
+                #[inline]
+                unsafe fn destruct_n(this: ::core::pin::Pin<&mut [Self]>) {
+                    let this = this.get_unchecked_mut();
+                    self::cxx_abi_record(CxxAbiOp::Destruct, || {
+                        self::ffi::cxx_destruct_n(this.as_mut_ptr(), this.len())
+                    })
+                }
+            }
+        }
+    } else {
+        syn::parse_quote! {
+            unsafe impl #generics_binder ::cxx_memory::Destruct for #ident #generics {
+            }
+        }
+    }
+}
+
 #[cfg(feature = "alloc")]
 fn emit_impl_debug(
     info: &CxxAbiArtifactInfo,
@@ -284,8 +394,10 @@ fn emit_impl_debug(
         syn::parse_quote! {
             impl #generics_binder ::core::fmt::Debug for #ident #generics {
                 fn fmt(&self, f: &mut ::core::fmt::Formatter<'_>) -> ::core::fmt::Result {
-                    let string = self::ffi::cxx_debug(self);
-                    write!(f, "{string}")
+                    self::cxx_abi_record(CxxAbiOp::Debug, || {
+                        let debug = |sink| unsafe { self::ffi::cxx_debug(self, sink) };
+                        ::cxx_memory::fmt::CxxFormatSink::with(f, debug)
+                    })
                 }
             }
         }
@@ -320,6 +432,16 @@ fn emit_impl_default(
                         })
                     }
                 }
+
+                #[inline]
+                pub(crate) fn default_new_n(len: usize) -> impl ::cxx_memory::NewSlice<Output = #ident #generics> {
+                    unsafe {
+                        ::cxx_memory::new::slice_by_raw(len, move |this| {
+                            let this = this.get_unchecked_mut();
+                            self::ffi::cxx_default_new_n(this.as_mut_ptr().cast::<Self>(), this.len());
+                        })
+                    }
+                }
             }
         })
     } else {
@@ -334,12 +456,23 @@ fn emit_impl_display(
     generics_binder: &syn::Generics,
     generics: &syn::Generics,
 ) -> Option<syn::ItemImpl> {
-    if info.is_rust_display {
+    if info.is_rust_display && info.cxx_is_displayable_as_string_view {
         Some(syn::parse_quote! {
             impl #generics_binder ::core::fmt::Display for #ident #generics {
                 fn fmt(&self, f: &mut ::core::fmt::Formatter<'_>) -> ::core::fmt::Result {
-                    let string = self::ffi::cxx_display(self);
-                    write!(f, "{string}")
+                    let bytes = self::cxx_abi_record(CxxAbiOp::Display, || self::ffi::cxx_display_bytes(self));
+                    ::cxx_memory::fmt::write_lossy(f, bytes)
+                }
+            }
+        })
+    } else if info.is_rust_display {
+        Some(syn::parse_quote! {
+            impl #generics_binder ::core::fmt::Display for #ident #generics {
+                fn fmt(&self, f: &mut ::core::fmt::Formatter<'_>) -> ::core::fmt::Result {
+                    self::cxx_abi_record(CxxAbiOp::Display, || {
+                        let display = |sink| unsafe { self::ffi::cxx_display(self, sink) };
+                        ::cxx_memory::fmt::CxxFormatSink::with(f, display)
+                    })
                 }
             }
         })
@@ -355,13 +488,39 @@ fn emit_impl_moveit_copy_new(
     generics_binder: &syn::Generics,
     generics: &syn::Generics,
 ) -> Option<syn::ItemImpl> {
-    if info.is_rust_copy_new {
+    if info.is_rust_copy_new_trivial() {
+        Some(syn::parse_quote! {
+            unsafe impl #generics_binder ::cxx_memory::CopyNew for #ident #generics {
+                #[inline]
+                unsafe fn copy_new(that: &Self, this: ::core::pin::Pin<&mut ::core::mem::MaybeUninit<Self>>) {
+                    let this = this.get_unchecked_mut().as_mut_ptr();
+                    ::core::ptr::copy_nonoverlapping(that, this, 1)
+                }
+
+                #[inline]
+                unsafe fn copy_new_n(that: &[Self], this: ::core::pin::Pin<&mut [::core::mem::MaybeUninit<Self>]>) {
+                    let this = this.get_unchecked_mut();
+                    ::core::assert_eq!(this.len(), that.len());
+                    ::core::ptr::copy_nonoverlapping(that.as_ptr(), this.as_mut_ptr().cast::<Self>(), that.len())
+                }
+            }
+        })
+    } else if info.is_rust_copy_new {
         Some(syn::parse_quote! {
             unsafe impl #generics_binder ::cxx_memory::CopyNew for #ident #generics {
                 #[inline]
                 unsafe fn copy_new(that: &Self, this: ::core::pin::Pin<&mut ::core::mem::MaybeUninit<Self>>) {
                     let this = this.get_unchecked_mut().as_mut_ptr();
-                    self::ffi::cxx_copy_new(this, that)
+                    self::cxx_abi_record(CxxAbiOp::CopyNew, || self::ffi::cxx_copy_new(this, that))
+                }
+
+                #[inline]
+                unsafe fn copy_new_n(that: &[Self], this: ::core::pin::Pin<&mut [::core::mem::MaybeUninit<Self>]>) {
+                    let this = this.get_unchecked_mut();
+                    ::core::assert_eq!(this.len(), that.len());
+                    self::cxx_abi_record(CxxAbiOp::CopyNew, || {
+                        self::ffi::cxx_copy_new_n(this.as_mut_ptr().cast::<Self>(), that.as_ptr(), that.len())
+                    })
                 }
             }
         })
@@ -377,7 +536,34 @@ fn emit_impl_moveit_move_new(
     generics_binder: &syn::Generics,
     generics: &syn::Generics,
 ) -> Option<syn::ItemImpl> {
-    if info.is_rust_move_new {
+    if info.is_rust_move_new_trivial() {
+        // NOTE: the source is released rather than dropped, so the bitwise copy is a relocation
+        Some(syn::parse_quote! {
+            unsafe impl #generics_binder ::cxx_memory::MoveNew for #ident #generics {
+                #[inline]
+                unsafe fn move_new(
+                    that: ::core::pin::Pin<::cxx_memory::MoveRef<'_, Self>>,
+                    this: ::core::pin::Pin<&mut ::core::mem::MaybeUninit<Self>>,
+                ) {
+                    let this = this.get_unchecked_mut().as_mut_ptr();
+                    let that = ::cxx_memory::MoveRef::release(that);
+                    ::core::ptr::copy_nonoverlapping(that, this, 1)
+                }
+
+                #[inline]
+                unsafe fn move_new_n(
+                    that: ::core::pin::Pin<::cxx_memory::MoveRef<'_, [Self]>>,
+                    this: ::core::pin::Pin<&mut [::core::mem::MaybeUninit<Self>]>,
+                ) {
+                    let this = this.get_unchecked_mut();
+                    let that = &mut *::cxx_memory::MoveRef::release(that);
+                    ::core::assert_eq!(this.len(), that.len());
+                    ::core::ptr::copy_nonoverlapping(that.as_ptr(), this.as_mut_ptr().cast::<Self>(), that.len())
+                }
+            }
+        })
+    } else if info.is_rust_move_new {
+        // NOTE: `move_new_n` relocates, so the moved-from elements are destroyed by the same call across the bridge
         Some(syn::parse_quote! {
             unsafe impl #generics_binder ::cxx_memory::MoveNew for #ident #generics {
                 #[inline]
@@ -387,7 +573,20 @@ fn emit_impl_moveit_move_new(
                 ) {
                     let this = this.get_unchecked_mut().as_mut_ptr();
                     let that = &mut *::core::pin::Pin::into_inner_unchecked(that);
-                    self::ffi::cxx_move_new(this, that)
+                    self::cxx_abi_record(CxxAbiOp::MoveNew, || self::ffi::cxx_move_new(this, that))
+                }
+
+                #[inline]
+                unsafe fn move_new_n(
+                    that: ::core::pin::Pin<::cxx_memory::MoveRef<'_, [Self]>>,
+                    this: ::core::pin::Pin<&mut [::core::mem::MaybeUninit<Self>]>,
+                ) {
+                    let this = this.get_unchecked_mut();
+                    let that = &mut *::cxx_memory::MoveRef::release(that);
+                    ::core::assert_eq!(this.len(), that.len());
+                    self::cxx_abi_record(CxxAbiOp::MoveNew, || {
+                        self::ffi::cxx_relocate_n(this.as_mut_ptr().cast::<Self>(), that.as_mut_ptr(), that.len())
+                    })
                 }
             }
         })
@@ -408,7 +607,7 @@ fn emit_impl_partial_eq(
             Some(syn::parse_quote! {
                 #[inline]
                 fn ne(&self, other: &Self) -> bool {
-                    self::ffi::cxx_operator_not_equal(self, other)
+                    self::cxx_abi_record(CxxAbiOp::Eq, || self::ffi::cxx_operator_not_equal(self, other))
                 }
             })
         } else {
@@ -418,7 +617,7 @@ fn emit_impl_partial_eq(
             impl #generics_binder ::core::cmp::PartialEq for #ident #generics {
                 #[inline]
                 fn eq(&self, other: &Self) -> bool {
-                    self::ffi::cxx_operator_equal(self, other)
+                    self::cxx_abi_record(CxxAbiOp::Eq, || self::ffi::cxx_operator_equal(self, other))
                 }
                 #ne
             }
@@ -456,7 +655,7 @@ fn emit_impl_partial_ord(
             Some(syn::parse_quote! {
                 #[inline]
                 fn lt(&self, other: &Self) -> bool {
-                    self::ffi::cxx_operator_less_than(self, other)
+                    self::cxx_abi_record(CxxAbiOp::Cmp, || self::ffi::cxx_operator_less_than(self, other))
                 }
             })
         } else {
@@ -466,7 +665,7 @@ fn emit_impl_partial_ord(
             Some(syn::parse_quote! {
                 #[inline]
                 fn le(&self, other: &Self) -> bool {
-                    self::ffi::cxx_operator_less_than_or_equal(self, other)
+                    self::cxx_abi_record(CxxAbiOp::Cmp, || self::ffi::cxx_operator_less_than_or_equal(self, other))
                 }
             })
         } else {
@@ -476,7 +675,7 @@ fn emit_impl_partial_ord(
             Some(syn::parse_quote! {
                 #[inline]
                 fn gt(&self, other: &Self) -> bool {
-                    self::ffi::cxx_operator_greater_than(self, other)
+                    self::cxx_abi_record(CxxAbiOp::Cmp, || self::ffi::cxx_operator_greater_than(self, other))
                 }
             })
         } else {
@@ -486,7 +685,7 @@ fn emit_impl_partial_ord(
             Some(syn::parse_quote! {
                 #[inline]
                 fn ge(&self, other: &Self) -> bool {
-                    self::ffi::cxx_operator_greater_than_or_equal(self, other)
+                    self::cxx_abi_record(CxxAbiOp::Cmp, || self::ffi::cxx_operator_greater_than_or_equal(self, other))
                 }
             })
         } else {
@@ -496,7 +695,9 @@ fn emit_impl_partial_ord(
             impl #generics_binder ::core::cmp::PartialOrd for #ident #generics {
                 #[inline]
                 fn partial_cmp(&self, other: &Self) -> Option<::core::cmp::Ordering> {
-                    let res = self::ffi::cxx_operator_three_way_comparison(self, other);
+                    let res = self::cxx_abi_record(CxxAbiOp::Cmp, || {
+                        self::ffi::cxx_operator_three_way_comparison(self, other)
+                    });
                     if res == -1 {
                         Some(::core::cmp::Ordering::Less)
                     } else if res == 1 {
@@ -531,7 +732,9 @@ fn emit_impl_ord(
             impl #generics_binder ::core::cmp::Ord for #ident #generics {
                 #[inline]
                 fn cmp(&self, other: &Self) -> ::core::cmp::Ordering {
-                    let res = self::ffi::cxx_operator_three_way_comparison(self, other);
+                    let res = self::cxx_abi_record(CxxAbiOp::Cmp, || {
+                        self::ffi::cxx_operator_three_way_comparison(self, other)
+                    });
                     if res < 0 {
                         ::core::cmp::Ordering::Less
                     } else if res > 0 {
@@ -563,7 +766,7 @@ fn emit_impl_hash(
                 where
                     H: ::core::hash::Hasher,
                 {
-                    let hash = self::ffi::cxx_hash(self);
+                    let hash = self::cxx_abi_record(CxxAbiOp::Hash, || self::ffi::cxx_hash(self));
                     state.write_usize(hash);
                 }
             }
@@ -573,6 +776,199 @@ fn emit_impl_hash(
     }
 }
 
+#[cfg(feature = "alloc")]
+fn emit_impl_slice_algorithms(
+    info: &CxxAbiArtifactInfo,
+    ident: &syn::Ident,
+    generics_binder: &syn::Generics,
+    generics: &syn::Generics,
+) -> Option<syn::ItemImpl> {
+    let mut items = ::alloc::vec::Vec::<syn::ImplItemFn>::new();
+    if info.cxx_is_sortable {
+        items.push(syn::parse_quote! {
+            #[inline]
+            pub(crate) fn sort_slice(slice: &mut [Self]) {
+                unsafe { self::ffi::cxx_sort(slice.as_mut_ptr(), slice.len()) }
+            }
+        });
+        items.push(syn::parse_quote! {
+            #[inline]
+            pub(crate) fn stable_sort_slice(slice: &mut [Self]) {
+                unsafe { self::ffi::cxx_stable_sort(slice.as_mut_ptr(), slice.len()) }
+            }
+        });
+    }
+    if info.is_rust_ord {
+        items.push(syn::parse_quote! {
+            #[inline]
+            pub(crate) fn lower_bound_slice(slice: &[Self], value: &Self) -> usize {
+                unsafe { self::ffi::cxx_lower_bound(slice.as_ptr(), slice.len(), value) }
+            }
+        });
+    }
+    if info.cxx_is_deduplicable {
+        // NOTE: like `<[T]>::partition_dedup`, except that the duplicates are moved-from by `std::unique`
+        items.push(syn::parse_quote! {
+            #[inline]
+            pub(crate) fn partition_dedup_slice(slice: &mut [Self]) -> (&mut [Self], &mut [Self]) {
+                let len = unsafe { self::ffi::cxx_unique(slice.as_mut_ptr(), slice.len()) };
+                slice.split_at_mut(len)
+            }
+        });
+        items.push(syn::parse_quote! {
+            #[inline]
+            pub(crate) fn dedup(vec: &mut ::std::vec::Vec<Self>) {
+                let len = Self::partition_dedup_slice(vec).0.len();
+                vec.truncate(len);
+            }
+        });
+    }
+    if items.is_empty() {
+        None
+    } else {
+        Some(syn::parse_quote! {
+            impl #generics_binder #ident #generics {
+                #(#items)*
+            }
+        })
+    }
+}
+
+#[cfg(feature = "alloc")]
+fn emit_items_contiguous_range(
+    info: &CxxAbiArtifactInfo,
+    ident: &syn::Ident,
+    generics_binder: &syn::Generics,
+    generics: &syn::Generics,
+) -> ::alloc::vec::Vec<syn::Item> {
+    let value_type = match info.rust_value_type() {
+        Some(value_type) => value_type,
+        None => return ::alloc::vec![],
+    };
+    let value_size = &proc_macro2::Literal::usize_unsuffixed(info.value_size);
+    let value_align = &proc_macro2::Literal::usize_unsuffixed(info.value_align);
+    let mut items = ::alloc::vec::Vec::<syn::ImplItemFn>::new();
+    items.push(syn::parse_quote! {
+        #[inline]
+        pub(crate) fn as_slice(&self) -> &[#value_type] {
+            let bytes = self::ffi::cxx_as_bytes(self);
+            if bytes.is_empty() {
+                return &[];
+            }
+            ::core::debug_assert!(bytes.as_ptr().cast::<#value_type>().is_aligned());
+            let len = bytes.len() / ::core::mem::size_of::<#value_type>();
+            unsafe { ::core::slice::from_raw_parts(bytes.as_ptr().cast::<#value_type>(), len) }
+        }
+    });
+    if info.cxx_is_mutable_contiguous_range {
+        items.push(syn::parse_quote! {
+            #[inline]
+            pub(crate) fn as_mut_slice(self: ::core::pin::Pin<&mut Self>) -> &mut [#value_type] {
+                let bytes = self::ffi::cxx_as_mut_bytes(self);
+                if bytes.is_empty() {
+                    return &mut [];
+                }
+                ::core::debug_assert!(bytes.as_mut_ptr().cast::<#value_type>().is_aligned());
+                let len = bytes.len() / ::core::mem::size_of::<#value_type>();
+                unsafe { ::core::slice::from_raw_parts_mut(bytes.as_mut_ptr().cast::<#value_type>(), len) }
+            }
+        });
+    }
+    if info.cxx_is_extendable_from_slice {
+        items.push(syn::parse_quote! {
+            #[inline]
+            pub(crate) fn extend_from_slice(self: ::core::pin::Pin<&mut Self>, values: &[#value_type]) {
+                let len = ::core::mem::size_of_val(values);
+                let bytes = unsafe { ::core::slice::from_raw_parts(values.as_ptr().cast::<u8>(), len) };
+                unsafe { self::ffi::cxx_extend_from_bytes(self, bytes) }
+            }
+        });
+    }
+    if info.cxx_is_constructible_from_slice {
+        items.push(syn::parse_quote! {
+            #[inline]
+            pub(crate) fn from_slice(values: &[#value_type]) -> impl ::cxx_memory::New<Output = Self> + '_ {
+                unsafe {
+                    ::cxx_memory::new::by_raw(move |this| {
+                        let this = this.get_unchecked_mut().as_mut_ptr();
+                        let len = ::core::mem::size_of_val(values);
+                        let bytes = ::core::slice::from_raw_parts(values.as_ptr().cast::<u8>(), len);
+                        self::ffi::cxx_new_from_bytes(this, bytes);
+                    })
+                }
+            }
+        });
+    }
+    if info.cxx_is_constructible_from_slice && info.cxx_is_extendable_from_slice {
+        // NOTE: values are buffered on the stack and handed over in chunks, so no intermediate allocation is needed
+        items.push(syn::parse_quote! {
+            #[inline]
+            pub(crate) fn from_iter<I>(iter: I) -> impl ::cxx_memory::New<Output = Self>
+            where
+                I: ::core::iter::IntoIterator<Item = #value_type>,
+            {
+                const CHUNK: usize = 64;
+                fn fill<I>(iter: &mut I, chunk: &mut [::core::mem::MaybeUninit<#value_type>; CHUNK]) -> usize
+                where
+                    I: ::core::iter::Iterator<Item = #value_type>,
+                {
+                    let mut len = 0;
+                    while len < CHUNK {
+                        match iter.next() {
+                            Some(value) => chunk[len].write(value),
+                            None => break,
+                        };
+                        len += 1;
+                    }
+                    len * ::core::mem::size_of::<#value_type>()
+                }
+                unsafe {
+                    ::cxx_memory::new::by_raw(move |this| {
+                        let this = this.get_unchecked_mut().as_mut_ptr();
+                        let mut iter = iter.into_iter();
+                        let mut chunk =
+                            ::core::mem::MaybeUninit::<[::core::mem::MaybeUninit<#value_type>; CHUNK]>::uninit().assume_init();
+                        let len = fill(&mut iter, &mut chunk);
+                        let bytes = ::core::slice::from_raw_parts(chunk.as_ptr().cast::<u8>(), len);
+                        self::ffi::cxx_new_from_bytes(this, bytes);
+                        let mut this = ::core::pin::Pin::new_unchecked(&mut *this);
+                        loop {
+                            let len = fill(&mut iter, &mut chunk);
+                            if len == 0 {
+                                break;
+                            }
+                            let bytes = ::core::slice::from_raw_parts(chunk.as_ptr().cast::<u8>(), len);
+                            self::ffi::cxx_extend_from_bytes(this.as_mut(), bytes);
+                        }
+                    })
+                }
+            }
+        });
+    }
+    // NOTE: the slice views reinterpret C++ storage as Rust values, which needs at least the Rust alignment, and the
+    // `*_from_bytes` shims reinterpret Rust values as C++ values, which needs at least the C++ alignment
+    let assert_value_align: syn::Item = if info.cxx_is_constructible_from_slice || info.cxx_is_extendable_from_slice {
+        syn::parse_quote! {
+            const _: () = ::core::assert!(::core::mem::align_of::<#value_type>() == #value_align);
+        }
+    } else {
+        syn::parse_quote! {
+            const _: () = ::core::assert!(::core::mem::align_of::<#value_type>() <= #value_align);
+        }
+    };
+    ::alloc::vec![
+        syn::parse_quote! {
+            const _: () = ::core::assert!(::core::mem::size_of::<#value_type>() == #value_size);
+        },
+        assert_value_align,
+        syn::parse_quote! {
+            impl #generics_binder #ident #generics {
+                #(#items)*
+            }
+        },
+    ]
+}
+
 #[cfg(feature = "alloc")]
 fn emit_info_test_module(
     info: &CxxAbiArtifactInfo,
@@ -598,6 +994,24 @@ fn emit_info_test_module(
     } else {
         None
     };
+    let static_assert_is_send: syn::ItemMacro = if info.is_rust_send {
+        syn::parse_quote!(
+            ::static_assertions::assert_impl_all!(#ident #generics: ::core::marker::Send);
+        )
+    } else {
+        syn::parse_quote!(
+            ::static_assertions::assert_not_impl_any!(#ident #generics: ::core::marker::Send);
+        )
+    };
+    let static_assert_is_sync: syn::ItemMacro = if info.is_rust_sync {
+        syn::parse_quote!(
+            ::static_assertions::assert_impl_all!(#ident #generics: ::core::marker::Sync);
+        )
+    } else {
+        syn::parse_quote!(
+            ::static_assertions::assert_not_impl_any!(#ident #generics: ::core::marker::Sync);
+        )
+    };
     syn::parse_quote! {
         #[cfg(test)]
         mod info {
@@ -614,6 +1028,8 @@ fn emit_info_test_module(
                 }
                 #static_assert_is_copy
                 #static_assert_is_unpin
+                #static_assert_is_send
+                #static_assert_is_sync
             }
         }
     }
@@ -624,20 +1040,34 @@ fn emit_item_mod_cxx_bridge(info: &CxxAbiArtifactInfo, ident: &syn::Ident, gener
     let cxx_include = &info.cxx_include;
     let cxx_namespace = &info.cxx_namespace;
     let cxx_name = &info.cxx_name;
-    let cxx_copy_new: Option<syn::ForeignItemFn> = if info.is_rust_copy_new {
+    let cxx_copy_new: Option<syn::ForeignItemFn> = if info.is_rust_copy_new && !info.is_rust_copy_new_trivial() {
         Some(syn::parse_quote! {
             unsafe fn cxx_copy_new #generics (This: *mut #ident #generics, that: &#ident #generics);
         })
     } else {
         None
     };
-    let cxx_move_new: Option<syn::ForeignItemFn> = if info.is_rust_move_new {
+    let cxx_move_new: Option<syn::ForeignItemFn> = if info.is_rust_move_new && !info.is_rust_move_new_trivial() {
         Some(syn::parse_quote! {
             unsafe fn cxx_move_new #generics (This: *mut #ident #generics, that: *mut #ident #generics);
         })
     } else {
         None
     };
+    let cxx_copy_new_n: Option<syn::ForeignItemFn> = if info.is_rust_copy_new && !info.is_rust_copy_new_trivial() {
+        Some(syn::parse_quote! {
+            unsafe fn cxx_copy_new_n #generics (This: *mut #ident #generics, that: *const #ident #generics, n: usize);
+        })
+    } else {
+        None
+    };
+    let cxx_relocate_n: Option<syn::ForeignItemFn> = if info.is_rust_move_new && !info.is_rust_move_new_trivial() {
+        Some(syn::parse_quote! {
+            unsafe fn cxx_relocate_n #generics (This: *mut #ident #generics, that: *mut #ident #generics, n: usize);
+        })
+    } else {
+        None
+    };
     let cxx_default_new: Option<syn::ForeignItemFn> = if info.is_rust_default {
         Some(syn::parse_quote! {
             unsafe fn cxx_default_new #generics (This: *mut #ident #generics);
@@ -645,6 +1075,13 @@ fn emit_item_mod_cxx_bridge(info: &CxxAbiArtifactInfo, ident: &syn::Ident, gener
     } else {
         None
     };
+    let cxx_default_new_n: Option<syn::ForeignItemFn> = if info.is_rust_default {
+        Some(syn::parse_quote! {
+            unsafe fn cxx_default_new_n #generics (This: *mut #ident #generics, n: usize);
+        })
+    } else {
+        None
+    };
     let cxx_destruct: Option<syn::ForeignItemFn> = if info.is_rust_drop {
         Some(syn::parse_quote! {
             unsafe fn cxx_destruct #generics (This: *mut #ident #generics);
@@ -652,6 +1089,13 @@ fn emit_item_mod_cxx_bridge(info: &CxxAbiArtifactInfo, ident: &syn::Ident, gener
     } else {
         None
     };
+    let cxx_destruct_n: Option<syn::ForeignItemFn> = if info.is_rust_drop && !info.cxx_is_trivially_destructible {
+        Some(syn::parse_quote! {
+            unsafe fn cxx_destruct_n #generics (This: *mut #ident #generics, n: usize);
+        })
+    } else {
+        None
+    };
     let cxx_operator_equal: Option<syn::ForeignItemFn> = if info.is_rust_eq {
         Some(syn::parse_quote! {
             fn cxx_operator_equal #generics (This: & #ident #generics, That: & #ident #generics) -> bool;
@@ -709,20 +1153,107 @@ fn emit_item_mod_cxx_bridge(info: &CxxAbiArtifactInfo, ident: &syn::Ident, gener
     } else {
         None
     };
+    let cxx_sort: Option<syn::ForeignItemFn> = if info.cxx_is_sortable {
+        Some(syn::parse_quote! {
+            unsafe fn cxx_sort #generics (This: *mut #ident #generics, n: usize);
+        })
+    } else {
+        None
+    };
+    let cxx_stable_sort: Option<syn::ForeignItemFn> = if info.cxx_is_sortable {
+        Some(syn::parse_quote! {
+            unsafe fn cxx_stable_sort #generics (This: *mut #ident #generics, n: usize);
+        })
+    } else {
+        None
+    };
+    let cxx_lower_bound: Option<syn::ForeignItemFn> = if info.is_rust_ord {
+        Some(syn::parse_quote! {
+            unsafe fn cxx_lower_bound #generics (This: *const #ident #generics, n: usize, value: & #ident #generics) -> usize;
+        })
+    } else {
+        None
+    };
+    let cxx_unique: Option<syn::ForeignItemFn> = if info.cxx_is_deduplicable {
+        Some(syn::parse_quote! {
+            unsafe fn cxx_unique #generics (This: *mut #ident #generics, n: usize) -> usize;
+        })
+    } else {
+        None
+    };
     let cxx_debug: Option<syn::ForeignItemFn> = if info.is_rust_debug {
         Some(syn::parse_quote! {
-            fn cxx_debug #generics (This: & #ident #generics) -> String;
+            unsafe fn cxx_debug #generics (This: & #ident #generics, sink: *mut CxxFormatSink) -> bool;
+        })
+    } else {
+        None
+    };
+    let cxx_display: Option<syn::ForeignItemFn> = if info.is_rust_display && !info.cxx_is_displayable_as_string_view {
+        Some(syn::parse_quote! {
+            unsafe fn cxx_display #generics (This: & #ident #generics, sink: *mut CxxFormatSink) -> bool;
+        })
+    } else {
+        None
+    };
+    // NOTE: an explicit lifetime is needed for borrowed results since elision is ambiguous when `#ident` has lifetime
+    // parameters
+    let fn_generics = &{
+        let mut fn_generics = generics.clone();
+        fn_generics.params.insert(0, syn::parse_quote!('this));
+        fn_generics.lt_token.get_or_insert_with(Default::default);
+        fn_generics.gt_token.get_or_insert_with(Default::default);
+        fn_generics
+    };
+    let cxx_display_bytes: Option<syn::ForeignItemFn> =
+        if info.is_rust_display && info.cxx_is_displayable_as_string_view {
+            Some(syn::parse_quote! {
+                fn cxx_display_bytes #fn_generics (This: &'this #ident #generics) -> &'this [u8];
+            })
+        } else {
+            None
+        };
+    let has_rust_value_type = info.rust_value_type().is_some();
+    let cxx_as_bytes: Option<syn::ForeignItemFn> = if has_rust_value_type {
+        Some(syn::parse_quote! {
+            fn cxx_as_bytes #fn_generics (This: &'this #ident #generics) -> &'this [u8];
+        })
+    } else {
+        None
+    };
+    let cxx_as_mut_bytes: Option<syn::ForeignItemFn> = if has_rust_value_type && info.cxx_is_mutable_contiguous_range {
+        Some(syn::parse_quote! {
+            fn cxx_as_mut_bytes #fn_generics (This: Pin<&'this mut #ident #generics>) -> &'this mut [u8];
+        })
+    } else {
+        None
+    };
+    let cxx_new_from_bytes: Option<syn::ForeignItemFn> = if has_rust_value_type && info.cxx_is_constructible_from_slice
+    {
+        Some(syn::parse_quote! {
+            unsafe fn cxx_new_from_bytes #generics (This: *mut #ident #generics, bytes: &[u8]);
         })
     } else {
         None
     };
-    let cxx_display: Option<syn::ForeignItemFn> = if info.is_rust_display {
+    let cxx_extend_from_bytes: Option<syn::ForeignItemFn> = if has_rust_value_type && info.cxx_is_extendable_from_slice
+    {
         Some(syn::parse_quote! {
-            fn cxx_display #generics (This: & #ident #generics) -> String;
+            unsafe fn cxx_extend_from_bytes #generics (This: Pin<&mut #ident #generics>, bytes: &[u8]);
         })
     } else {
         None
     };
+    let item_type_cxx_format_sink: Option<syn::ItemForeignMod> =
+        if info.is_rust_debug || (info.is_rust_display && !info.cxx_is_displayable_as_string_view) {
+            Some(syn::parse_quote! {
+                #[namespace = "cxx_memory::abi"]
+                extern "C++" {
+                    type CxxFormatSink = ::cxx_memory::fmt::CxxFormatSink;
+                }
+            })
+        } else {
+            None
+        };
     syn::parse_quote! {
         #[cxx::bridge]
         pub(crate) mod ffi {
@@ -734,9 +1265,13 @@ fn emit_item_mod_cxx_bridge(info: &CxxAbiArtifactInfo, ident: &syn::Ident, gener
                 #[allow(unused)]
                 type #ident #generics = super :: #ident #generics;
                 #cxx_copy_new
+                #cxx_copy_new_n
                 #cxx_move_new
+                #cxx_relocate_n
                 #cxx_default_new
+                #cxx_default_new_n
                 #cxx_destruct
+                #cxx_destruct_n
                 #cxx_operator_equal
                 #cxx_operator_not_equal
                 #cxx_operator_less_than
@@ -745,9 +1280,19 @@ fn emit_item_mod_cxx_bridge(info: &CxxAbiArtifactInfo, ident: &syn::Ident, gener
                 #cxx_operator_greater_than_or_equal
                 #cxx_operator_three_way_comparison
                 #cxx_hash
+                #cxx_sort
+                #cxx_stable_sort
+                #cxx_lower_bound
+                #cxx_unique
                 #cxx_debug
                 #cxx_display
+                #cxx_display_bytes
+                #cxx_as_bytes
+                #cxx_as_mut_bytes
+                #cxx_new_from_bytes
+                #cxx_extend_from_bytes
             }
+            #item_type_cxx_format_sink
         }
     }
 }
@@ -776,15 +1321,27 @@ fn field_layout(size: &proc_macro2::Literal) -> syn::Field {
     emit_field(name, ty)
 }
 
+// NOTE: `_layout` is both `Send` and `Sync`, so a marker field takes away whichever of them was not opted into. A type
+// that is `Sync` but not `Send` gets the marker for neither, and `emit_impl_sync` implements `Sync` by hand.
 #[cfg(feature = "alloc")]
-fn field_neither_send_nor_sync(info: &CxxAbiArtifactInfo) -> Option<syn::Field> {
-    let is_neither_send_nor_sync = !info.is_rust_send && !info.is_rust_sync;
-    if is_neither_send_nor_sync {
-        let name = "_neither_send_nor_sync";
-        let ty = syn::parse_quote!(::core::marker::PhantomData<[*const u8; 0]>);
-        Some(emit_field(name, ty))
-    } else {
-        None
+fn field_send_sync(info: &CxxAbiArtifactInfo) -> Option<syn::Field> {
+    match (info.is_rust_send, info.is_rust_sync) {
+        (true, true) => None,
+        (true, false) => {
+            let name = "_not_sync";
+            let ty = syn::parse_quote!(::core::marker::PhantomData<::core::cell::Cell<()>>);
+            Some(emit_field(name, ty))
+        },
+        (false, false) => {
+            let name = "_neither_send_nor_sync";
+            let ty = syn::parse_quote!(::core::marker::PhantomData<[*const u8; 0]>);
+            Some(emit_field(name, ty))
+        },
+        (false, true) => {
+            let name = "_not_send";
+            let ty = syn::parse_quote!(::core::marker::PhantomData<[*const u8; 0]>);
+            Some(emit_field(name, ty))
+        },
     }
 }
 
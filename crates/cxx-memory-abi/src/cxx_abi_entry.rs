@@ -11,6 +11,8 @@ pub struct CxxAbiEntry<'ctx> {
     rust_name: &'ctx str,
     #[serde(default)]
     rust_lifetimes: ::indexmap::IndexMap<&'ctx str, ::alloc::vec::Vec<&'ctx str>>,
+    // NOTE: the Rust element type for contiguous containers (e.g., `"i32"` for `std::vector<int>`)
+    rust_value_type: Option<&'ctx str>,
 }
 
 #[cfg(feature = "alloc")]
@@ -23,7 +25,7 @@ impl<'ctx> CxxAbiEntry<'ctx> {
         &self,
         path_components: impl Iterator<Item = &'a ::alloc::string::String>,
         path_descendants: impl Iterator<Item = &'b ::alloc::string::String>,
-    ) -> ::alloc::vec::Vec<syn::ItemFn> {
+    ) -> crate::BoxResult<::alloc::vec::Vec<syn::ItemFn>> {
         let cxx_include = self.cxx_include;
         let cxx_namespace = self.cxx_namespace;
         let cxx_name = self.cxx_name();
@@ -35,7 +37,15 @@ impl<'ctx> CxxAbiEntry<'ctx> {
             }
             exprs
         };
-        ::alloc::vec![
+        let rust_value_type: syn::Expr = match self.rust_value_type {
+            Some(rust_value_type) => {
+                syn::parse_str::<syn::Type>(rust_value_type)
+                    .map_err(|err| ::alloc::format!("Invalid `rust_value_type` for `{rust_name}`: {err}"))?;
+                syn::parse_quote!(Some(#rust_value_type))
+            },
+            None => syn::parse_quote!(None),
+        };
+        Ok(::alloc::vec![
             syn::parse_quote! {
                 fn artifact_info() -> ::cxx_memory_abi::CxxAbiArtifactInfo {
                     let path_components = vec![#(#path_components),*];
@@ -44,15 +54,28 @@ impl<'ctx> CxxAbiEntry<'ctx> {
                     let cxx_namespace = #cxx_namespace;
                     let cxx_name = #cxx_name;
                     let rust_name = #rust_name;
+                    let rust_value_type = #rust_value_type;
                     let lifetimes = ::cxx_memory_abi::indexmap::IndexMap::from_iter([#(#lifetimes),*].into_iter());
                     let align = self::ffi::cxx_abi_align();
                     let size = self::ffi::cxx_abi_size();
+                    let value_size = self::ffi::cxx_abi_value_size();
+                    let value_align = self::ffi::cxx_abi_value_align();
                     let cxx_has_operator_equal = self::ffi::cxx_has_operator_equal();
                     let cxx_has_operator_not_equal = self::ffi::cxx_has_operator_not_equal();
                     let cxx_has_operator_less_than = self::ffi::cxx_has_operator_less_than();
                     let cxx_has_operator_less_than_or_equal = self::ffi::cxx_has_operator_less_than_or_equal();
                     let cxx_has_operator_greater_than = self::ffi::cxx_has_operator_greater_than();
                     let cxx_has_operator_greater_than_or_equal = self::ffi::cxx_has_operator_greater_than_or_equal();
+                    let cxx_is_trivially_copyable = self::ffi::cxx_is_trivially_copyable();
+                    let cxx_is_trivially_destructible = self::ffi::cxx_is_trivially_destructible();
+                    let cxx_is_trivially_relocatable = self::ffi::cxx_is_trivially_relocatable();
+                    let cxx_is_displayable_as_string_view = self::ffi::cxx_is_displayable_as_string_view();
+                    let cxx_is_sortable = self::ffi::cxx_is_sortable();
+                    let cxx_is_deduplicable = self::ffi::cxx_is_deduplicable();
+                    let cxx_is_contiguous_range = self::ffi::cxx_is_contiguous_range();
+                    let cxx_is_mutable_contiguous_range = self::ffi::cxx_is_mutable_contiguous_range();
+                    let cxx_is_constructible_from_slice = self::ffi::cxx_is_constructible_from_slice();
+                    let cxx_is_extendable_from_slice = self::ffi::cxx_is_extendable_from_slice();
                     let is_rust_cxx_extern_type_trivial = {
                         let cxx_is_trivially_movable = self::ffi::cxx_is_trivially_movable();
                         let rust_should_impl_cxx_extern_type_trivial = self::ffi::rust_should_impl_cxx_extern_type_trivial();
@@ -84,15 +107,28 @@ impl<'ctx> CxxAbiEntry<'ctx> {
                         cxx_namespace,
                         cxx_name,
                         rust_name,
+                        rust_value_type,
                         lifetimes,
                         align,
                         size,
+                        value_size,
+                        value_align,
                         cxx_has_operator_equal,
                         cxx_has_operator_not_equal,
                         cxx_has_operator_less_than,
                         cxx_has_operator_less_than_or_equal,
                         cxx_has_operator_greater_than,
                         cxx_has_operator_greater_than_or_equal,
+                        cxx_is_trivially_copyable,
+                        cxx_is_trivially_destructible,
+                        cxx_is_trivially_relocatable,
+                        cxx_is_displayable_as_string_view,
+                        cxx_is_sortable,
+                        cxx_is_deduplicable,
+                        cxx_is_contiguous_range,
+                        cxx_is_mutable_contiguous_range,
+                        cxx_is_constructible_from_slice,
+                        cxx_is_extendable_from_slice,
                         is_rust_cxx_extern_type_trivial,
                         is_rust_unpin,
                         is_rust_send,
@@ -113,11 +149,11 @@ impl<'ctx> CxxAbiEntry<'ctx> {
                 }
             },
             syn::parse_quote! {
-                pub(crate) fn write_module() -> ::cxx_memory_abi::BoxResult<()> {
-                    self::artifact_info().write_module_for_file()
+                pub(crate) fn write_module(writer: &mut ::cxx_memory_abi::CxxAbiModuleWriter) {
+                    writer.push_artifact(self::artifact_info());
                 }
             },
-        ]
+        ])
     }
 
     pub(crate) fn emit_item_mod_cxx_bridge(&self) -> [syn::Item; 2] {
@@ -135,6 +171,8 @@ impl<'ctx> CxxAbiEntry<'ctx> {
                         include!(#include);
                         fn cxx_abi_align() -> usize;
                         fn cxx_abi_size() -> usize;
+                        fn cxx_abi_value_size() -> usize;
+                        fn cxx_abi_value_align() -> usize;
                         fn cxx_is_copy_constructible() -> bool;
                         fn cxx_is_move_constructible() -> bool;
                         fn cxx_is_default_constructible() -> bool;
@@ -142,6 +180,7 @@ impl<'ctx> CxxAbiEntry<'ctx> {
                         fn cxx_is_trivially_copyable() -> bool;
                         fn cxx_is_trivially_movable() -> bool;
                         fn cxx_is_trivially_destructible() -> bool;
+                        fn cxx_is_trivially_relocatable() -> bool;
                         fn cxx_is_equality_comparable() -> bool;
                         fn cxx_has_operator_equal() -> bool;
                         fn cxx_has_operator_not_equal() -> bool;
@@ -151,7 +190,14 @@ impl<'ctx> CxxAbiEntry<'ctx> {
                         fn cxx_has_operator_greater_than_or_equal() -> bool;
                         fn cxx_is_partially_ordered() -> bool;
                         fn cxx_is_totally_ordered() -> bool;
+                        fn cxx_is_sortable() -> bool;
+                        fn cxx_is_deduplicable() -> bool;
+                        fn cxx_is_contiguous_range() -> bool;
+                        fn cxx_is_mutable_contiguous_range() -> bool;
+                        fn cxx_is_constructible_from_slice() -> bool;
+                        fn cxx_is_extendable_from_slice() -> bool;
                         fn cxx_is_hashable() -> bool;
+                        fn cxx_is_displayable_as_string_view() -> bool;
                         fn rust_should_impl_cxx_extern_type_trivial() -> bool;
                         fn rust_should_impl_unpin() -> bool;
                         fn rust_should_impl_send() -> bool;
@@ -9,6 +9,8 @@ extern crate std;
 mod cxx_abi_artifact_info;
 mod cxx_abi_entry;
 mod error;
+#[cfg(feature = "std")]
+mod module_writer;
 mod ffi {
     pub(crate) mod ctypes;
 }
@@ -17,6 +19,8 @@ mod gen {
 }
 mod processing;
 
+#[cfg(feature = "std")]
+pub use crate::module_writer::CxxAbiModuleWriter;
 #[cfg(feature = "alloc")]
 pub use crate::{cxx_abi_artifact_info::CxxAbiArtifactInfo, cxx_abi_entry::CxxAbiEntry, error::*};
 #[cfg(feature = "alloc")]
@@ -0,0 +1,385 @@
+use crate::{BoxResult, CxxAbiArtifactInfo};
+use quote::ToTokens;
+use std::{
+    collections::BTreeMap,
+    path::{Path, PathBuf},
+};
+
+// NOTE: identifies the generator build, since generated modules depend on the generator as well as on their inputs
+const GENERATOR_VERSION: &str = env!("CXX_MEMORY_ABI_GENERATOR_VERSION");
+
+type Emit = ::alloc::boxed::Box<dyn FnOnce() -> BoxResult<::alloc::string::String> + Send>;
+
+// NOTE: a module that has not been emitted yet, along with a hash of the inputs it will be emitted from
+struct PendingModule {
+    path: PathBuf,
+    inputs: u64,
+    emit: Emit,
+}
+
+// NOTE: collects generated modules and writes them in one pass. Modules whose inputs and written output are unchanged
+// since the last pass are not even emitted, and the others are only rewritten if their formatted output changed (which
+// would otherwise bump their mtimes and force the dependent crate to rebuild).
+pub struct CxxAbiModuleWriter {
+    root: PathBuf,
+    manifest: PathBuf,
+    modules: ::alloc::vec::Vec<PendingModule>,
+}
+
+impl CxxAbiModuleWriter {
+    pub fn new(root: impl Into<PathBuf>, manifest: &str) -> Self {
+        let root = root.into();
+        let manifest = root.join(manifest);
+        Self {
+            root,
+            manifest,
+            modules: ::alloc::vec![],
+        }
+    }
+
+    // NOTE: `path` is relative to the writer root and should include the `.rs` extension
+    pub fn push_file(&mut self, path: impl Into<PathBuf>, file: syn::File) {
+        let source = file.to_token_stream().to_string();
+        self.push_source(path, source);
+    }
+
+    // NOTE: like `push_file`, for modules that were already converted to (unformatted) source text
+    pub fn push_source(&mut self, path: impl Into<PathBuf>, source: ::alloc::string::String) {
+        let inputs = source.as_bytes().to_vec();
+        self.push_lazy(path, &inputs, move || Ok(source));
+    }
+
+    // NOTE: `emit` is only run in `finish`, and only if `inputs` (everything the module is emitted from) or the written
+    // module changed since the last pass
+    pub fn push_lazy<F>(&mut self, path: impl Into<PathBuf>, inputs: &[u8], emit: F)
+    where
+        F: FnOnce() -> BoxResult<::alloc::string::String> + Send + 'static,
+    {
+        self.modules.push(PendingModule {
+            path: path.into(),
+            inputs: fnv1a(inputs),
+            emit: ::alloc::boxed::Box::new(emit),
+        });
+    }
+
+    pub fn push_dir(&mut self, path_components: &[&str], path_descendants: &[&str]) {
+        let path = CxxAbiArtifactInfo::module_path(path_components);
+        let file = CxxAbiArtifactInfo::emit_file_for_dir(path_descendants);
+        self.push_file(path, file);
+    }
+
+    // NOTE: artifacts are emitted lazily in `finish` so that emission can happen in parallel (or be skipped)
+    pub fn push_artifact(&mut self, info: CxxAbiArtifactInfo) {
+        let path = CxxAbiArtifactInfo::module_path(&info.path_components);
+        let inputs = ::alloc::format!("{info:?}");
+        self.push_lazy(path, inputs.as_bytes(), move || Ok(info.emit_file().to_token_stream().to_string()));
+    }
+
+    pub fn finish(self) -> BoxResult<()> {
+        let previous = read_manifest(&self.manifest);
+        let seed = fnv1a_with(fnv1a(&rustfmt_fingerprint()), GENERATOR_VERSION.as_bytes());
+        let (mut manifest, stale) = partition_stale(&self.root, &previous, seed, self.modules);
+
+        let written = parallel_map(stale, |(key, entry, module)| {
+            let contents = rustfmt(&(module.emit)()?)?;
+            let path = self.root.join(module.path);
+            if let Some(parent) = path.parent() {
+                std::fs::create_dir_all(parent)?;
+            }
+            write_if_changed(&path, contents.as_bytes())?;
+            Ok((key, ManifestEntry {
+                output: hash_hex(fnv1a(contents.as_bytes())),
+                ..entry
+            }))
+        })?;
+        manifest.extend(written);
+
+        write_manifest(&self.manifest, &manifest)?;
+        Ok(())
+    }
+}
+
+#[derive(Clone, Debug, Default, PartialEq, Eq, serde::Deserialize, serde::Serialize)]
+struct ManifestEntry {
+    inputs: ::alloc::string::String,
+    output: ::alloc::string::String,
+}
+
+type Manifest = BTreeMap<::alloc::string::String, ManifestEntry>;
+
+fn hash_hex(hash: u64) -> ::alloc::string::String {
+    ::alloc::format!("{hash:016x}")
+}
+
+// NOTE: a module is fresh when the hash of its inputs (seeded with the formatter fingerprint and generator version) is
+// unchanged and its file still has the contents that were last written. Fresh modules keep their manifest entries,
+// while stale ones are returned with an entry whose `output` is filled in once they are written.
+fn partition_stale(
+    root: &Path,
+    previous: &Manifest,
+    seed: u64,
+    modules: ::alloc::vec::Vec<PendingModule>,
+) -> (Manifest, ::alloc::vec::Vec<(::alloc::string::String, ManifestEntry, PendingModule)>) {
+    let mut manifest = BTreeMap::new();
+    let mut stale = ::alloc::vec![];
+    for module in modules {
+        let key = module.path.to_string_lossy().into_owned();
+        let inputs = hash_hex(fnv1a_with(seed, &module.inputs.to_le_bytes()));
+        let fresh = previous.get(&key).filter(|entry| {
+            entry.inputs == inputs
+                && std::fs::read(root.join(&module.path))
+                    .is_ok_and(|contents| hash_hex(fnv1a(&contents)) == entry.output)
+        });
+        match fresh {
+            Some(entry) => {
+                manifest.insert(key, entry.clone());
+            },
+            None => {
+                let entry = ManifestEntry {
+                    inputs,
+                    output: ::alloc::string::String::new(),
+                };
+                stale.push((key, entry, module));
+            },
+        }
+    }
+    (manifest, stale)
+}
+
+pub(crate) fn write_if_changed(path: &Path, contents: &[u8]) -> BoxResult<bool> {
+    if std::fs::read(path).is_ok_and(|existing| existing == contents) {
+        return Ok(false);
+    }
+    std::fs::write(path, contents)?;
+    Ok(true)
+}
+
+fn read_manifest(path: &Path) -> Manifest {
+    std::fs::read_to_string(path)
+        .ok()
+        .and_then(|text| serde_json::from_str(&text).ok())
+        .unwrap_or_default()
+}
+
+fn write_manifest(path: &Path, manifest: &Manifest) -> BoxResult<bool> {
+    let contents = serde_json::to_string_pretty(manifest)?;
+    write_if_changed(path, contents.as_bytes())
+}
+
+// NOTE: the hash only needs to be stable across builds, not cryptographically strong
+fn fnv1a(bytes: &[u8]) -> u64 {
+    fnv1a_with(0xcbf2_9ce4_8422_2325, bytes)
+}
+
+fn fnv1a_with(mut hash: u64, bytes: &[u8]) -> u64 {
+    for byte in bytes {
+        hash ^= u64::from(*byte);
+        hash = hash.wrapping_mul(0x0100_0000_01b3);
+    }
+    hash
+}
+
+pub(crate) fn parallel_map<T, U, F>(items: ::alloc::vec::Vec<T>, f: F) -> BoxResult<::alloc::vec::Vec<U>>
+where
+    T: Send,
+    U: Send,
+    F: Fn(T) -> BoxResult<U> + Sync,
+{
+    let threads = std::thread::available_parallelism().map_or(1, core::num::NonZeroUsize::get);
+    let chunk_size = items.len().div_ceil(threads).max(1);
+    let mut chunks = ::alloc::vec::Vec::new();
+    let mut items = items.into_iter().peekable();
+    while items.peek().is_some() {
+        chunks.push(items.by_ref().take(chunk_size).collect::<::alloc::vec::Vec<_>>());
+    }
+    let f = &f;
+    std::thread::scope(|scope| {
+        let handles = chunks
+            .into_iter()
+            .map(|chunk| scope.spawn(move || chunk.into_iter().map(f).collect::<BoxResult<::alloc::vec::Vec<_>>>()))
+            .collect::<::alloc::vec::Vec<_>>();
+        let mut results = ::alloc::vec::Vec::new();
+        for handle in handles {
+            match handle.join() {
+                Ok(result) => results.extend(result?),
+                Err(panic) => std::panic::resume_unwind(panic),
+            }
+        }
+        Ok(results)
+    })
+}
+
+fn rustfmt_command() -> std::process::Command {
+    let rustfmt = std::env::var_os("RUSTFMT").unwrap_or_else(|| "rustfmt".into());
+    std::process::Command::new(rustfmt)
+}
+
+// NOTE: formatted output depends on the `rustfmt` version and configuration as well as on the source, so both are
+// folded into the module hashes. When reading from stdin, `rustfmt` looks for its configuration starting from the
+// current directory.
+fn rustfmt_fingerprint() -> ::alloc::vec::Vec<u8> {
+    let mut fingerprint = rustfmt_command()
+        .arg("--version")
+        .output()
+        .map(|output| output.stdout)
+        .unwrap_or_default();
+    if let Ok(dir) = std::env::current_dir() {
+        let config = dir
+            .ancestors()
+            .flat_map(|dir| [dir.join(".rustfmt.toml"), dir.join("rustfmt.toml")])
+            .find(|path| path.is_file());
+        if let Some(config) = config {
+            fingerprint.extend(std::fs::read(config).unwrap_or_default());
+        }
+    }
+    fingerprint
+}
+
+// NOTE: sources are piped through stdin since `rustfmt` would otherwise try to resolve out-of-line `mod` items
+fn rustfmt(source: &str) -> BoxResult<::alloc::string::String> {
+    use std::io::Write;
+    let mut child = rustfmt_command()
+        .args(["--edition", "2021", "--emit", "stdout"])
+        .stdin(std::process::Stdio::piped())
+        .stdout(std::process::Stdio::piped())
+        .stderr(std::process::Stdio::piped())
+        .spawn()?;
+    if let Some(mut stdin) = child.stdin.take() {
+        stdin.write_all(source.as_bytes())?;
+    }
+    let output = child.wait_with_output()?;
+    if !output.status.success() {
+        let stderr = ::alloc::string::String::from_utf8_lossy(&output.stderr);
+        return Err(::alloc::format!("Failed to format generated module: {stderr}").into());
+    }
+    Ok(::alloc::string::String::from_utf8(output.stdout)?)
+}
+
+#[cfg(test)]
+mod test {
+    use super::*;
+
+    struct TempDir(PathBuf);
+
+    impl TempDir {
+        fn new(name: &str) -> Self {
+            let dir = std::env::temp_dir().join(::alloc::format!("cxx-memory-abi-{name}-{}", std::process::id()));
+            let _ = std::fs::remove_dir_all(&dir);
+            std::fs::create_dir_all(&dir).unwrap();
+            Self(dir)
+        }
+    }
+
+    impl Drop for TempDir {
+        fn drop(&mut self) {
+            let _ = std::fs::remove_dir_all(&self.0);
+        }
+    }
+
+    #[test]
+    fn fnv1a_matches_reference_values() {
+        assert_eq!(fnv1a(b""), 0xcbf2_9ce4_8422_2325);
+        assert_eq!(fnv1a(b"a"), 0xaf63_dc4c_8601_ec8c);
+        assert_eq!(fnv1a(b"foobar"), 0x8594_4171_f739_67e8);
+        assert_eq!(fnv1a_with(fnv1a(b"foo"), b"bar"), fnv1a(b"foobar"));
+    }
+
+    #[test]
+    fn manifest_round_trips() {
+        let dir = TempDir::new("manifest");
+        let path = dir.0.join("manifest.json");
+        assert!(read_manifest(&path).is_empty());
+        let entry = ManifestEntry {
+            inputs: "0123456789abcdef".into(),
+            output: "fedcba9876543210".into(),
+        };
+        let manifest = Manifest::from([("abi/a.rs".into(), entry)]);
+        assert!(write_manifest(&path, &manifest).unwrap());
+        assert_eq!(read_manifest(&path), manifest);
+        assert!(!write_manifest(&path, &manifest).unwrap());
+        std::fs::write(&path, "not json").unwrap();
+        assert!(read_manifest(&path).is_empty());
+    }
+
+    fn pending(path: &str, inputs: &str) -> PendingModule {
+        PendingModule {
+            path: PathBuf::from(path),
+            inputs: fnv1a(inputs.as_bytes()),
+            emit: ::alloc::boxed::Box::new(|| -> BoxResult<::alloc::string::String> { unreachable!() }),
+        }
+    }
+
+    #[test]
+    fn partition_stale_detects_changed_inputs_and_outputs() {
+        let dir = TempDir::new("stale");
+        let modules = |inputs: [&str; 4]| {
+            ["same.rs", "changed.rs", "edited.rs", "missing.rs"]
+                .into_iter()
+                .zip(inputs)
+                .map(|(path, inputs)| pending(path, inputs))
+                .collect::<::alloc::vec::Vec<_>>()
+        };
+        let (manifest, stale) = partition_stale(&dir.0, &Manifest::new(), 0, modules(["a", "b", "c", "d"]));
+        assert!(manifest.is_empty());
+
+        // NOTE: stands in for `finish`, which writes each stale module and records the hash of what it wrote
+        let mut previous = Manifest::new();
+        for (key, entry, module) in stale {
+            std::fs::write(dir.0.join(module.path), key.as_bytes()).unwrap();
+            let output = hash_hex(fnv1a(key.as_bytes()));
+            previous.insert(key, ManifestEntry { output, ..entry });
+        }
+        std::fs::write(dir.0.join("edited.rs"), "edited by hand").unwrap();
+        std::fs::remove_file(dir.0.join("missing.rs")).unwrap();
+
+        let (manifest, stale) = partition_stale(&dir.0, &previous, 0, modules(["a", "b again", "c", "d"]));
+        assert_eq!(manifest.keys().collect::<::alloc::vec::Vec<_>>(), ["same.rs"]);
+        let stale = stale.into_iter().map(|(key, ..)| key).collect::<::alloc::vec::Vec<_>>();
+        assert_eq!(stale, ["changed.rs", "edited.rs", "missing.rs"]);
+
+        // NOTE: a different formatter fingerprint or generator version invalidates every module
+        let (manifest, stale) = partition_stale(&dir.0, &previous, 1, modules(["a", "b", "c", "d"]));
+        assert!(manifest.is_empty());
+        assert_eq!(stale.len(), 4);
+    }
+
+    #[test]
+    fn finish_only_emits_stale_modules() {
+        let dir = TempDir::new("finish");
+        let emitted = std::sync::Arc::new(core::sync::atomic::AtomicUsize::new(0));
+        let finish = |source: &'static str| {
+            let mut writer = CxxAbiModuleWriter::new(&dir.0, "manifest.json");
+            for path in ["a.rs", "b.rs"] {
+                let emitted = emitted.clone();
+                writer.push_lazy(path, source.as_bytes(), move || {
+                    emitted.fetch_add(1, core::sync::atomic::Ordering::Relaxed);
+                    Ok(source.into())
+                });
+            }
+            writer.finish().unwrap();
+            emitted.load(core::sync::atomic::Ordering::Relaxed)
+        };
+        assert_eq!(finish("fn f() {}"), 2);
+        assert_eq!(finish("fn f() {}"), 2);
+        std::fs::write(dir.0.join("a.rs"), "").unwrap();
+        assert_eq!(finish("fn f() {}"), 3);
+        assert_eq!(std::fs::read_to_string(dir.0.join("a.rs")).unwrap(), "fn f() {}\n");
+        assert_eq!(finish("fn g() {}"), 5);
+    }
+
+    #[test]
+    fn write_if_changed_keeps_mtime_of_unchanged_file() {
+        let dir = TempDir::new("mtime");
+        let path = dir.0.join("module.rs");
+        assert!(write_if_changed(&path, b"fn f() {}").unwrap());
+        let past = std::time::SystemTime::now() - std::time::Duration::from_secs(3600);
+        std::fs::File::options().write(true).open(&path).unwrap().set_modified(past).unwrap();
+        let mtime = || std::fs::metadata(&path).unwrap().modified().unwrap();
+
+        assert!(!write_if_changed(&path, b"fn f() {}").unwrap());
+        assert_eq!(mtime(), past);
+
+        assert!(write_if_changed(&path, b"fn g() {}").unwrap());
+        assert_ne!(mtime(), past);
+    }
+}
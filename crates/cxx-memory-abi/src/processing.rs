@@ -1,9 +1,11 @@
 #[cfg(feature = "alloc")]
 use crate::BoxResult;
 
-use proc_macro2::Span;
+#[cfg(feature = "std")]
+use crate::CxxAbiModuleWriter;
+#[cfg(feature = "std")]
 use quote::ToTokens;
-use rust_format::Formatter;
+use proc_macro2::Span;
 #[cfg(feature = "std")]
 use std::collections::BTreeSet;
 
@@ -13,17 +15,29 @@ pub(crate) fn process_src_abi_module(abi_dir: &std::path::Path, abi_crate_src_di
     let abi_dir_walker = walkdir::WalkDir::new(abi_dir).min_depth(1);
     let skip_paths = std::collections::BTreeSet::new();
     let mut walked_path_components = ::alloc::vec::Vec::new();
+    let mut writer = CxxAbiModuleWriter::new(src_dir, ".cxx-memory-abi-bridges.json");
+    let mut file_modules = ::alloc::vec::Vec::new();
 
     process_src_abi_sub_module(
-        &src_dir,
+        &mut writer,
+        &mut file_modules,
         abi_dir_walker.into_iter(),
         skip_paths,
         &mut walked_path_components,
     )?;
 
+    // NOTE: the walk itself is cheap; parsing the JSON entries and emitting their bridges is what dominates, so that
+    // part is left to the writer, which spreads it across threads and skips it for entries whose inputs are unchanged
+    for module in file_modules {
+        let text = std::fs::read_to_string(&module.path)?;
+        let inputs = module.inputs(&text);
+        let path = module.module_path.clone();
+        writer.push_lazy(path, inputs.as_bytes(), move || emit_abi_sub_module_for_file(module, &text));
+    }
+
     walked_path_components.sort();
 
-    let contents = {
+    let file = {
         let mut path_descendants = BTreeSet::new();
         let mut item_mods = ::alloc::vec![];
         emit_item_mods_for_path_descendants(
@@ -35,23 +49,43 @@ pub(crate) fn process_src_abi_module(abi_dir: &std::path::Path, abi_crate_src_di
         let item_write_module = emit_item_write_module_for_dir(&::alloc::vec![], &path_descendants);
         let item_fn_process_artifact_infos =
             emit_item_fn_process_artifact_infos((&[::alloc::vec![]]).iter().chain(walked_path_components.iter()));
-        let file: syn::File = syn::parse_quote! {
+        // NOTE: an ABI crate writes the modules to its own `src`, but a build script can write them to `OUT_DIR`
+        syn::parse_quote! {
             //! NOTE: This module is auto-generated and should not be edited.
             #(#item_mods)*
             #item_write_module
+            pub fn process_artifacts() -> ::cxx_memory_abi::BoxResult<()> {
+                self::process_artifacts_into("src")
+            }
             #item_fn_process_artifact_infos
-        };
-        let tokens = file.to_token_stream();
-        rust_format::RustFmt::default().format_tokens(tokens)?
+        }
     };
-    std::fs::write(src_dir.join("abi.rs"), contents)?;
+    writer.push_file("abi.rs", file);
 
-    Ok(())
+    writer.finish()
+}
+
+// NOTE: an ABI entry found during the walk whose module is emitted afterwards, in parallel with the others
+#[cfg(feature = "std")]
+struct CxxAbiFileModule {
+    path: std::path::PathBuf,
+    path_components: ::alloc::vec::Vec<::alloc::string::String>,
+    path_descendants: BTreeSet<::alloc::string::String>,
+    module_path: std::path::PathBuf,
+}
+
+#[cfg(feature = "std")]
+impl CxxAbiFileModule {
+    // NOTE: everything the module is emitted from besides the generator itself, which the writer accounts for
+    fn inputs(&self, text: &str) -> ::alloc::string::String {
+        ::alloc::format!("{:?}\n{:?}\n{text}", self.path_components, self.path_descendants)
+    }
 }
 
 #[cfg(feature = "std")]
 fn process_src_abi_sub_module(
-    src_dir: &std::path::Path,
+    writer: &mut CxxAbiModuleWriter,
+    file_modules: &mut ::alloc::vec::Vec<CxxAbiFileModule>,
     mut abi_dir_walker: impl Iterator<Item = walkdir::Result<walkdir::DirEntry>>,
     mut skip_paths: std::collections::BTreeSet<std::path::PathBuf>,
     walked_path_file_components: &mut ::alloc::vec::Vec<::alloc::vec::Vec<::alloc::string::String>>,
@@ -75,41 +109,25 @@ fn process_src_abi_sub_module(
                 emit_item_mods_for_path_descendants(&mut skip_paths, path, &mut path_descendants, &mut item_mods)?;
             }
 
-            let mut items_write_module: ::alloc::vec::Vec<syn::ItemFn> = ::alloc::vec![];
-            let mut item_mod_cxx_bridge: ::alloc::vec::Vec<syn::Item> = ::alloc::vec![];
+            let abi_sub_module_path = crate::CxxAbiArtifactInfo::module_path(&path_components);
 
             if let Some(path) = &path_file {
                 skip_paths.insert(path.to_path_buf());
-                let text = std::fs::read_to_string(&path)?;
-                let data = serde_json::from_str::<crate::CxxAbiEntry>(&text)?;
-                items_write_module =
-                    data.emit_items_write_module_for_file(path_components.iter(), path_descendants.iter());
-                item_mod_cxx_bridge.extend(data.emit_item_mod_cxx_bridge());
+                file_modules.push(CxxAbiFileModule {
+                    path: path.to_path_buf(),
+                    path_components: path_components.clone(),
+                    path_descendants,
+                    module_path: abi_sub_module_path,
+                });
             } else {
-                items_write_module.push(emit_item_write_module_for_dir(&path_components, &path_descendants));
+                let item_write_module = emit_item_write_module_for_dir(&path_components, &path_descendants);
+                let file = emit_abi_sub_module(item_mods, ::alloc::vec![], ::alloc::vec![item_write_module]);
+                writer.push_file(abi_sub_module_path, file);
             }
 
-            let abi_sub_module_path = src_dir.join(
-                [::alloc::string::String::from("abi")]
-                    .iter()
-                    .chain(&path_components)
-                    .collect::<std::path::PathBuf>(),
-            );
-
             walked_path_file_components.push(path_components);
-
-            if let Some(parent) = abi_sub_module_path.parent() {
-                std::fs::create_dir_all(parent)?;
-            }
-
-            write_abi_sub_module(
-                &abi_sub_module_path.with_extension("rs"),
-                item_mods,
-                item_mod_cxx_bridge,
-                items_write_module,
-            )?;
         }
-        process_src_abi_sub_module(src_dir, abi_dir_walker, skip_paths, walked_path_file_components)?;
+        process_src_abi_sub_module(writer, file_modules, abi_dir_walker, skip_paths, walked_path_file_components)?;
     }
     Ok(())
 }
@@ -122,12 +140,16 @@ fn emit_item_mods_for_path_descendants(
 ) -> BoxResult<()> {
     skip_paths.insert(path.to_path_buf());
     find_immediate_path_descendants(&path, path_descendants)?;
+    items.extend(emit_item_mods(path_descendants));
+    Ok(())
+}
+
+fn emit_item_mods(path_descendants: &BTreeSet<::alloc::string::String>) -> impl Iterator<Item = syn::ItemMod> + '_ {
     let span = Span::call_site();
-    for descendant in path_descendants.iter() {
+    path_descendants.iter().map(move |descendant| {
         let ident = syn::Ident::new(descendant, span);
-        items.push(syn::parse_quote!(pub mod #ident;))
-    }
-    Ok(())
+        syn::parse_quote!(pub mod #ident;)
+    })
 }
 
 #[cfg(feature = "std")]
@@ -136,10 +158,10 @@ fn emit_item_write_module_for_dir(
     path_descendants: &BTreeSet<::alloc::string::String>,
 ) -> syn::ItemFn {
     syn::parse_quote! {
-        pub(crate) fn write_module() -> ::cxx_memory_abi::BoxResult<()> {
+        pub(crate) fn write_module(writer: &mut ::cxx_memory_abi::CxxAbiModuleWriter) {
             let path_components = &[#(#path_components),*];
             let path_descendants = &[#(#path_descendants),*];
-            ::cxx_memory_abi::CxxAbiArtifactInfo::write_module_for_dir(path_components, path_descendants)
+            writer.push_dir(path_components, path_descendants);
         }
     }
 }
@@ -158,15 +180,16 @@ fn emit_item_fn_process_artifact_infos<'a>(
                 .collect(),
         };
         if path_components.is_empty() {
-            syn::parse_quote!(self::write_module()?;)
+            syn::parse_quote!(self::write_module(&mut writer);)
         } else {
-            syn::parse_quote!(self::#path::write_module()?;)
+            syn::parse_quote!(self::#path::write_module(&mut writer);)
         }
     });
     syn::parse_quote! {
-        pub fn process_artifacts() -> ::cxx_memory_abi::BoxResult<()> {
+        pub fn process_artifacts_into(root: impl Into<::std::path::PathBuf>) -> ::cxx_memory_abi::BoxResult<()> {
+            let mut writer = ::cxx_memory_abi::CxxAbiModuleWriter::new(root, ".cxx-memory-abi-modules.json");
             #(#items)*
-            Ok(())
+            writer.finish()
         }
     }
 }
@@ -213,20 +236,25 @@ fn relativized_components_from_path(path: &std::path::Path) -> BoxResult<::alloc
 }
 
 #[cfg(feature = "std")]
-fn write_abi_sub_module(
-    path: &std::path::Path,
+fn emit_abi_sub_module_for_file(module: CxxAbiFileModule, text: &str) -> BoxResult<::alloc::string::String> {
+    let data = serde_json::from_str::<crate::CxxAbiEntry>(text)?;
+    let items_write_module =
+        data.emit_items_write_module_for_file(module.path_components.iter(), module.path_descendants.iter())?;
+    let item_mods = emit_item_mods(&module.path_descendants).collect();
+    let file = emit_abi_sub_module(item_mods, data.emit_item_mod_cxx_bridge().into(), items_write_module);
+    Ok(file.to_token_stream().to_string())
+}
+
+#[cfg(feature = "std")]
+fn emit_abi_sub_module(
     item_mods: ::alloc::vec::Vec<syn::ItemMod>,
     item_mod_cxx_bridge: ::alloc::vec::Vec<syn::Item>,
     items_write_module: ::alloc::vec::Vec<syn::ItemFn>,
-) -> BoxResult<()> {
-    let file: syn::File = syn::parse_quote! {
+) -> syn::File {
+    syn::parse_quote! {
         //! NOTE: This module is auto-generated and should not be edited.
         #(#item_mods)*
         #(#item_mod_cxx_bridge)*
         #(#items_write_module)*
-    };
-    let tokens = file.to_token_stream();
-    let contents = rust_format::RustFmt::default().format_tokens(tokens)?;
-    std::fs::write(path.with_extension("rs"), contents)?;
-    Ok(())
+    }
 }
@@ -0,0 +1,253 @@
+use crate::{
+    move_ref::MoveRef,
+    new::{New, TryNew},
+    slot_storage::SlotStorageTracker,
+};
+use core::{
+    alloc::Layout,
+    cell::{Cell, RefCell},
+    mem::MaybeUninit,
+    pin::Pin,
+    ptr::NonNull,
+};
+
+const ARENA_CHUNK_SIZE: usize = 4096;
+const ARENA_CHUNK_ALIGN: usize = 16;
+
+struct ArenaChunk {
+    ptr: NonNull<u8>,
+    layout: Layout,
+}
+
+struct ArenaDrop {
+    ptr: *mut u8,
+    drop: unsafe fn(*mut u8),
+    tracker: Option<NonNull<SlotStorageTracker>>,
+}
+
+pub struct Arena {
+    chunks: RefCell<crate::Vec<ArenaChunk>>,
+    cursor: Cell<*mut u8>,
+    end: Cell<*mut u8>,
+    drops: RefCell<crate::Vec<ArenaDrop>>,
+}
+
+impl Default for Arena {
+    #[inline]
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl Drop for Arena {
+    #[inline]
+    fn drop(&mut self) {
+        self.run_drops();
+        for chunk in self.chunks.get_mut().drain(..) {
+            unsafe { alloc::alloc::dealloc(chunk.ptr.as_ptr(), chunk.layout) };
+        }
+    }
+}
+
+impl Arena {
+    #[inline]
+    pub fn new() -> Self {
+        Self {
+            chunks: RefCell::new(crate::Vec::new()),
+            cursor: Cell::new(core::ptr::null_mut()),
+            end: Cell::new(core::ptr::null_mut()),
+            drops: RefCell::new(crate::Vec::new()),
+        }
+    }
+
+    #[inline]
+    pub fn emplace<T, N: New<Output = T>>(&self, new: N) -> Pin<MoveRef<'_, T>> {
+        match self.try_emplace(new) {
+            Ok(pin) => pin,
+            Err(err) => match err {},
+        }
+    }
+
+    // NOTE: dropping the returned handle runs the destructor immediately; if the handle is forgotten instead, the
+    // destructor is deferred until the arena is reset (or dropped).
+    #[inline]
+    pub fn try_emplace<T, N: TryNew<Output = T>>(&self, new: N) -> Result<Pin<MoveRef<'_, T>>, N::Error> {
+        let tracker = self
+            .alloc_layout(Layout::new::<SlotStorageTracker>())
+            .cast::<SlotStorageTracker>();
+        unsafe { tracker.write(SlotStorageTracker::new()) };
+        let memory = self.alloc_layout(Layout::new::<T>()).cast::<MaybeUninit<T>>();
+        unsafe { new.try_new(Pin::new_unchecked(&mut *memory))? };
+        let ptr = memory.cast::<T>();
+        let tracker = unsafe { &*tracker };
+        let status = tracker.status();
+        status.initialize();
+        self.register_drop(ptr, Some(NonNull::from(tracker)));
+        let mov = unsafe { MoveRef::new_unchecked(&mut *ptr, status) };
+        Ok(mov.into_pin())
+    }
+
+    #[inline]
+    pub fn alloc<T, N: New<Output = T>>(&self, new: N) -> Pin<&mut T> {
+        match self.try_alloc(new) {
+            Ok(pin) => pin,
+            Err(err) => match err {},
+        }
+    }
+
+    // NOTE: the arena owns the returned object and runs its destructor when it is reset (or dropped)
+    #[inline]
+    pub fn try_alloc<T, N: TryNew<Output = T>>(&self, new: N) -> Result<Pin<&mut T>, N::Error> {
+        let memory = self.alloc_layout(Layout::new::<T>()).cast::<MaybeUninit<T>>();
+        unsafe { new.try_new(Pin::new_unchecked(&mut *memory))? };
+        let ptr = memory.cast::<T>();
+        self.register_drop(ptr, None);
+        Ok(unsafe { Pin::new_unchecked(&mut *ptr) })
+    }
+
+    // NOTE: destructors run in reverse order of construction and only for types that need dropping; all but the most
+    // recent chunk are then released, and the remaining chunk is reused for subsequent allocations.
+    pub fn reset(&mut self) {
+        self.run_drops();
+        let chunks = self.chunks.get_mut();
+        if let Some(last) = chunks.pop() {
+            for chunk in chunks.drain(..) {
+                unsafe { alloc::alloc::dealloc(chunk.ptr.as_ptr(), chunk.layout) };
+            }
+            self.cursor.set(last.ptr.as_ptr());
+            self.end.set(unsafe { last.ptr.as_ptr().add(last.layout.size()) });
+            chunks.push(last);
+        }
+    }
+
+    #[inline]
+    fn register_drop<T>(&self, ptr: *mut T, tracker: Option<NonNull<SlotStorageTracker>>) {
+        unsafe fn drop_in_place<T>(ptr: *mut u8) {
+            core::ptr::drop_in_place(ptr.cast::<T>())
+        }
+        if core::mem::needs_drop::<T>() {
+            let ptr = ptr.cast::<u8>();
+            let drop = drop_in_place::<T>;
+            self.drops.borrow_mut().push(ArenaDrop { ptr, drop, tracker });
+        }
+    }
+
+    fn run_drops(&mut self) {
+        for entry in self.drops.get_mut().drain(..).rev() {
+            if let Some(tracker) = entry.tracker {
+                // NOTE: only handles which were forgotten still own their object at this point
+                let status = unsafe { tracker.as_ref() }.status();
+                if !status.is_leaking() {
+                    continue;
+                }
+            }
+            unsafe { (entry.drop)(entry.ptr) };
+        }
+    }
+
+    #[inline]
+    fn alloc_layout(&self, layout: Layout) -> *mut u8 {
+        if layout.size() == 0 {
+            return layout.align() as *mut u8;
+        }
+        if let Some(ptr) = self.bump(layout) {
+            return ptr;
+        }
+        self.grow(layout);
+        match self.bump(layout) {
+            Some(ptr) => ptr,
+            None => unreachable!("A fresh chunk always has room for the requested layout"),
+        }
+    }
+
+    #[inline]
+    fn bump(&self, layout: Layout) -> Option<*mut u8> {
+        let cursor = self.cursor.get();
+        if cursor.is_null() {
+            return None;
+        }
+        let offset = cursor.align_offset(layout.align());
+        let available = self.end.get() as usize - cursor as usize;
+        if offset.checked_add(layout.size())? > available {
+            return None;
+        }
+        let ptr = unsafe { cursor.add(offset) };
+        self.cursor.set(unsafe { ptr.add(layout.size()) });
+        Some(ptr)
+    }
+
+    #[cold]
+    fn grow(&self, layout: Layout) {
+        let mut chunks = self.chunks.borrow_mut();
+        let previous = chunks.last().map_or(0, |chunk| chunk.layout.size());
+        let size = ARENA_CHUNK_SIZE.max(previous.saturating_mul(2)).max(layout.size());
+        let align = ARENA_CHUNK_ALIGN.max(layout.align());
+        let layout = match Layout::from_size_align(size, align) {
+            Ok(layout) => layout,
+            Err(err) => panic!("Invalid arena chunk layout: {err}"),
+        };
+        let ptr = match NonNull::new(unsafe { alloc::alloc::alloc(layout) }) {
+            Some(ptr) => ptr,
+            None => alloc::alloc::handle_alloc_error(layout),
+        };
+        self.cursor.set(ptr.as_ptr());
+        self.end.set(unsafe { ptr.as_ptr().add(size) });
+        chunks.push(ArenaChunk { ptr, layout });
+    }
+}
+
+#[cfg(test)]
+mod test {
+    use super::*;
+
+    struct Counted {
+        value: usize,
+        drops: crate::Rc<Cell<usize>>,
+    }
+
+    impl Drop for Counted {
+        fn drop(&mut self) {
+            self.drops.set(self.drops.get() + 1);
+        }
+    }
+
+    #[test]
+    fn emplace_and_reset() {
+        let drops = crate::Rc::new(Cell::new(0));
+        let mut arena = Arena::new();
+        for _ in 0 .. 2 {
+            let dropped = arena.emplace(crate::new::of(Counted {
+                value: 1,
+                drops: drops.clone(),
+            }));
+            let forgotten = arena.emplace(crate::new::of(Counted {
+                value: 2,
+                drops: drops.clone(),
+            }));
+            let owned = arena.alloc(crate::new::of(Counted {
+                value: 3,
+                drops: drops.clone(),
+            }));
+            assert_eq!(dropped.value + forgotten.value + owned.value, 6);
+            drop(dropped);
+            core::mem::forget(forgotten);
+            assert_eq!(drops.get(), 1);
+            arena.reset();
+            assert_eq!(drops.get(), 3);
+            drops.set(0);
+        }
+    }
+
+    #[test]
+    fn alloc_respects_alignment() {
+        #[repr(align(64))]
+        struct Aligned(#[allow(unused)] u8);
+
+        let arena = Arena::new();
+        for _ in 0 .. 256 {
+            let _ = arena.alloc(crate::new::of(0u8));
+            let aligned = arena.alloc(crate::new::of(Aligned(0)));
+            assert_eq!(&*aligned as *const Aligned as usize % 64, 0);
+        }
+    }
+}
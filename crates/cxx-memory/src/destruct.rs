@@ -0,0 +1,77 @@
+use core::pin::Pin;
+
+pub unsafe trait Destruct: Sized {
+    // NOTE: implementations backed by FFI should override this to cross the language boundary once per slice
+    #[inline]
+    unsafe fn destruct_n(this: Pin<&mut [Self]>) {
+        core::ptr::drop_in_place(Pin::into_inner_unchecked(this) as *mut [Self])
+    }
+}
+
+// NOTE: destroys every element with a single `Destruct::destruct_n` rather than dropping them one at a time
+#[cfg(feature = "alloc")]
+#[inline]
+pub fn boxed_slice<T: Destruct>(this: Pin<crate::Box<[T]>>) {
+    unsafe {
+        let this = crate::Box::into_raw(Pin::into_inner_unchecked(this));
+        T::destruct_n(Pin::new_unchecked(&mut *this));
+        drop(crate::Box::from_raw(this as *mut [core::mem::MaybeUninit<T>]));
+    }
+}
+
+// NOTE: destroys every element with a single `Destruct::destruct_n` and then frees the storage
+#[cfg(feature = "alloc")]
+#[inline]
+pub fn vec<T: Destruct>(mut this: crate::Vec<T>) {
+    unsafe {
+        let len = this.len();
+        this.set_len(0);
+        let elements = core::slice::from_raw_parts_mut(this.as_mut_ptr(), len);
+        T::destruct_n(Pin::new_unchecked(elements));
+    }
+}
+
+#[cfg(all(test, feature = "alloc"))]
+mod test {
+    use super::*;
+    use core::cell::Cell;
+
+    struct Counted<'a> {
+        drops: &'a Cell<usize>,
+        batches: &'a Cell<usize>,
+    }
+
+    impl Drop for Counted<'_> {
+        fn drop(&mut self) {
+            self.drops.set(self.drops.get() + 1);
+        }
+    }
+
+    unsafe impl Destruct for Counted<'_> {
+        unsafe fn destruct_n(this: Pin<&mut [Self]>) {
+            let this = Pin::into_inner_unchecked(this);
+            if let Some(first) = this.first() {
+                first.batches.set(first.batches.get() + 1);
+            }
+            core::ptr::drop_in_place(this as *mut [Self])
+        }
+    }
+
+    #[test]
+    fn vec_destructs_in_one_batch() {
+        let drops = &Cell::new(0);
+        let batches = &Cell::new(0);
+        let vec = (0 .. 5).map(|_| Counted { drops, batches }).collect::<crate::Vec<_>>();
+        super::vec(vec);
+        assert_eq!((drops.get(), batches.get()), (5, 1));
+    }
+
+    #[test]
+    fn boxed_slice_destructs_in_one_batch() {
+        let drops = &Cell::new(0);
+        let batches = &Cell::new(0);
+        let vec = (0 .. 3).map(|_| Counted { drops, batches }).collect::<crate::Vec<_>>();
+        super::boxed_slice(crate::Box::into_pin(vec.into_boxed_slice()));
+        assert_eq!((drops.get(), batches.get()), (3, 1));
+    }
+}
@@ -1,4 +1,4 @@
-use crate::new::{New, TryNew};
+use crate::new::{New, NewSlice, TryNew, TryNewSlice};
 use core::{mem::MaybeUninit, ops::Deref, pin::Pin};
 
 pub trait Emplace<T>: Sized + Deref {
@@ -66,3 +66,198 @@ impl<T> Emplace<T> for crate::Arc<T> {
         Ok(pin)
     }
 }
+
+pub trait EmplaceSlice<T>: Sized {
+    type Output;
+
+    #[inline]
+    fn emplace_slice<N: NewSlice<Output = T>>(new: N) -> Self::Output {
+        match Self::try_emplace_slice(new) {
+            Ok(val) => val,
+            Err(err) => match err {},
+        }
+    }
+
+    fn try_emplace_slice<N: TryNewSlice<Output = T>>(new: N) -> Result<Self::Output, N::Error>;
+}
+
+#[cfg(feature = "alloc")]
+impl<T> EmplaceSlice<T> for crate::Box<[T]> {
+    type Output = Pin<Self>;
+
+    #[inline]
+    fn try_emplace_slice<N: TryNewSlice<Output = T>>(new: N) -> Result<Self::Output, N::Error> {
+        // NOTE: the elements are constructed directly in their final allocation, since converting from a `Vec` may
+        // reallocate (and move them bitwise) when its capacity does not exactly match its length
+        let mut uninit = crate::Box::<[T]>::new_uninit_slice(TryNewSlice::len(&new));
+        let pin = unsafe { Pin::new_unchecked(&mut *uninit) };
+        unsafe { new.try_new_slice(pin)? };
+        let ptr = unsafe { uninit.assume_init() };
+        Ok(crate::Box::into_pin(ptr))
+    }
+}
+
+pub trait EmplaceExtend<T> {
+    fn emplace_extend<N: NewSlice<Output = T>>(&mut self, new: N);
+}
+
+#[cfg(feature = "alloc")]
+impl<T: crate::MoveNew> EmplaceExtend<T> for crate::Vec<T> {
+    #[inline]
+    fn emplace_extend<N: NewSlice<Output = T>>(&mut self, new: N) {
+        let len = self.len();
+        let additional = NewSlice::len(&new);
+        if self.capacity() - len < additional {
+            // NOTE: the elements may not be trivially relocatable, so rather than letting the `Vec` reallocate (which
+            // would move them bitwise) we grow into fresh storage and relocate them with `MoveNew::move_new_n`.
+            let capacity = core::cmp::max(len + additional, self.capacity() * 2);
+            let mut grown = crate::Vec::<T>::with_capacity(capacity);
+            unsafe {
+                self.set_len(0);
+                let tracker = crate::slot_storage::SlotStorageTracker::new();
+                let status = tracker.status();
+                status.initialize();
+                let src = core::slice::from_raw_parts_mut(self.as_mut_ptr(), len);
+                let src = crate::MoveRef::new_unchecked(src, status).into_pin();
+                let dst = Pin::new_unchecked(&mut grown.spare_capacity_mut()[.. len]);
+                crate::MoveNew::move_new_n(src, dst);
+                grown.set_len(len);
+            }
+            *self = grown;
+        }
+        let pin = unsafe { Pin::new_unchecked(&mut self.spare_capacity_mut()[.. additional]) };
+        unsafe { new.new_slice(pin) };
+        unsafe { self.set_len(len + additional) };
+    }
+}
+
+#[cfg(test)]
+mod test {
+    use super::*;
+    #[cfg(feature = "alloc")]
+    use core::cell::Cell;
+
+    // NOTE: self-referential, so any bitwise relocation that bypasses `MoveNew` is caught by `check`
+    #[cfg(feature = "alloc")]
+    struct Tracked<'a> {
+        this: *const Self,
+        live: &'a Cell<isize>,
+    }
+
+    #[cfg(feature = "alloc")]
+    impl<'a> Tracked<'a> {
+        unsafe fn construct(that: Pin<&mut MaybeUninit<Self>>, live: &'a Cell<isize>) {
+            let that = Pin::into_inner_unchecked(that);
+            let this = that.as_ptr();
+            that.write(Tracked { this, live });
+            live.set(live.get() + 1);
+        }
+
+        fn check(&self) {
+            assert_eq!(self.this, self as *const Self);
+        }
+    }
+
+    #[cfg(feature = "alloc")]
+    impl Drop for Tracked<'_> {
+        fn drop(&mut self) {
+            self.check();
+            self.live.set(self.live.get() - 1);
+        }
+    }
+
+    #[cfg(feature = "alloc")]
+    unsafe impl crate::CopyNew for Tracked<'_> {
+        unsafe fn copy_new(src: &Self, dst: Pin<&mut MaybeUninit<Self>>) {
+            src.check();
+            Self::construct(dst, src.live);
+        }
+    }
+
+    #[cfg(feature = "alloc")]
+    unsafe impl crate::MoveNew for Tracked<'_> {
+        unsafe fn move_new(src: Pin<crate::MoveRef<Self>>, dst: Pin<&mut MaybeUninit<Self>>) {
+            src.check();
+            Self::construct(dst, src.live);
+        }
+    }
+
+    #[cfg(feature = "alloc")]
+    unsafe impl crate::Destruct for Tracked<'_> {
+    }
+
+    #[cfg(feature = "alloc")]
+    #[test]
+    fn emplace_slice_copies() {
+        let src = [1, 2, 3];
+        let dst = <crate::Box<[i32]> as EmplaceSlice<i32>>::emplace_slice(crate::new::copy_n(&src));
+        assert_eq!(&*dst, &src);
+    }
+
+    #[cfg(feature = "alloc")]
+    #[test]
+    fn emplace_extend_relocates() {
+        let mut vec = crate::Vec::<i32>::new();
+        for i in 0 .. 4 {
+            vec.emplace_extend(crate::new::copy_n(&[i]));
+        }
+        vec.emplace_extend(crate::new::default_n(2));
+        assert_eq!(vec, [0, 1, 2, 3, 0, 0]);
+    }
+
+    #[cfg(feature = "alloc")]
+    #[test]
+    fn emplace_slice_constructs_in_place() {
+        let live = &Cell::new(0);
+        let src = <crate::Box<[Tracked]> as EmplaceSlice<_>>::emplace_slice(unsafe {
+            crate::new::slice_by_raw(1, |this: Pin<&mut [MaybeUninit<Tracked>]>| {
+                Tracked::construct(Pin::new_unchecked(&mut Pin::into_inner_unchecked(this)[0]), live)
+            })
+        });
+        let dst = <crate::Box<[Tracked]> as EmplaceSlice<_>>::emplace_slice(crate::new::copy_n(&*src));
+        dst.iter().for_each(Tracked::check);
+        assert_eq!(live.get(), 2);
+        drop((src, dst));
+        assert_eq!(live.get(), 0);
+    }
+
+    #[cfg(feature = "alloc")]
+    #[test]
+    fn try_emplace_slice_propagates_errors() {
+        let live = &Cell::new(0);
+        let new = unsafe {
+            crate::new::try_slice_by_raw(4, |this: Pin<&mut [MaybeUninit<Tracked>]>| {
+                let this = Pin::into_inner_unchecked(this);
+                for slot in &mut this[.. 2] {
+                    Tracked::construct(Pin::new_unchecked(slot), live);
+                }
+                for slot in &mut this[.. 2] {
+                    slot.assume_init_drop();
+                }
+                Err("failed")
+            })
+        };
+        let result = <crate::Box<[Tracked]> as EmplaceSlice<_>>::try_emplace_slice(new);
+        assert!(matches!(result, Err("failed")));
+        assert_eq!(live.get(), 0);
+    }
+
+    #[cfg(feature = "alloc")]
+    #[test]
+    fn emplace_extend_relocates_with_move_new() {
+        let live = &Cell::new(0);
+        let src = <crate::Box<[Tracked]> as EmplaceSlice<_>>::emplace_slice(unsafe {
+            crate::new::slice_by_raw(1, |this: Pin<&mut [MaybeUninit<Tracked>]>| {
+                Tracked::construct(Pin::new_unchecked(&mut Pin::into_inner_unchecked(this)[0]), live)
+            })
+        });
+        let mut vec = crate::Vec::<Tracked>::new();
+        for _ in 0 .. 6 {
+            vec.emplace_extend(crate::new::copy_n(&*src));
+            vec.iter().for_each(Tracked::check);
+        }
+        assert_eq!(live.get(), 7);
+        crate::destruct::vec(vec);
+        assert_eq!(live.get(), 1);
+    }
+}
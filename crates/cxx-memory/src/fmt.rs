@@ -0,0 +1,74 @@
+// NOTE: the layout of `CxxFormatSink` is private to Rust; C++ only ever sees it as an opaque pointer
+pub struct CxxFormatSink {
+    write: *mut (dyn core::fmt::Write + 'static),
+}
+
+unsafe impl cxx::ExternType for CxxFormatSink {
+    type Id = cxx::type_id!("cxx_memory::abi::CxxFormatSink");
+    type Kind = cxx::kind::Opaque;
+}
+
+impl CxxFormatSink {
+    #[inline]
+    pub fn with<F>(write: &mut dyn core::fmt::Write, f: F) -> core::fmt::Result
+    where
+        F: FnOnce(*mut CxxFormatSink) -> bool,
+    {
+        let write = unsafe {
+            core::mem::transmute::<*mut (dyn core::fmt::Write + '_), *mut (dyn core::fmt::Write + 'static)>(write)
+        };
+        let mut sink = CxxFormatSink { write };
+        if f(&mut sink) { Ok(()) } else { Err(core::fmt::Error) }
+    }
+}
+
+#[inline]
+pub fn write_lossy(write: &mut dyn core::fmt::Write, mut bytes: &[u8]) -> core::fmt::Result {
+    loop {
+        match core::str::from_utf8(bytes) {
+            Ok(str) => return write.write_str(str),
+            Err(err) => {
+                let (valid, invalid) = bytes.split_at(err.valid_up_to());
+                write.write_str(unsafe { core::str::from_utf8_unchecked(valid) })?;
+                write.write_char(core::char::REPLACEMENT_CHARACTER)?;
+                bytes = &invalid[err.error_len().unwrap_or(invalid.len()) ..];
+            },
+        }
+    }
+}
+
+// NOTE: called by `cxx_format_streambuf` in `cxx-memory-abi.hxx`, which never splits a UTF-8 sequence across calls
+#[export_name = "cxx_memory$abi$cxx_format_sink_write"]
+unsafe extern "C" fn cxx_format_sink_write(sink: *mut CxxFormatSink, data: *const u8, len: usize) -> bool {
+    let write = &mut *(*sink).write;
+    let bytes = if len == 0 {
+        &[][..]
+    } else {
+        core::slice::from_raw_parts(data, len)
+    };
+    write_lossy(write, bytes).is_ok()
+}
+
+#[cfg(all(test, feature = "alloc"))]
+mod test {
+    use super::*;
+    use alloc::string::String;
+
+    #[test]
+    fn write_lossy_replaces_invalid_sequences() {
+        let mut out = String::new();
+        write_lossy(&mut out, b"a\xFFb\xE2\x82c\xF0\x9F\x92").unwrap();
+        assert_eq!(out, "a\u{FFFD}b\u{FFFD}c\u{FFFD}");
+    }
+
+    // NOTE: `write_lossy` is stateless, which is why `cxx_format_streambuf` must not split sequences between calls (see
+    // `cxx-memory-abi/cxx/test/format_streambuf.cxx`)
+    #[test]
+    fn write_lossy_replaces_split_sequences() {
+        let euro = "€".as_bytes();
+        let mut out = String::new();
+        write_lossy(&mut out, &euro[.. 1]).unwrap();
+        write_lossy(&mut out, &euro[1 ..]).unwrap();
+        assert_eq!(out, "\u{FFFD}\u{FFFD}\u{FFFD}");
+    }
+}
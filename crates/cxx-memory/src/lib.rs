@@ -3,25 +3,41 @@
 #[cfg(feature = "alloc")]
 extern crate alloc;
 
+#[cfg(feature = "std")]
+extern crate std;
+
 #[cfg(feature = "alloc")]
-pub(crate) use alloc::{boxed::Box, rc::Rc, sync::Arc};
+pub(crate) use alloc::{boxed::Box, rc::Rc, sync::Arc, vec::Vec};
 
 #[macro_use]
 mod macros;
 
+#[cfg(feature = "alloc")]
+mod arena;
 mod deref_move;
+pub mod destruct;
 mod emplace;
+#[cfg(feature = "cxx")]
+pub mod fmt;
 mod into_move;
 mod move_ref;
 pub mod new;
+#[cfg(feature = "alloc")]
+mod pool;
 mod slot;
 mod slot_storage;
+pub mod stats;
 
+#[cfg(feature = "alloc")]
+pub use arena::Arena;
 pub use deref_move::DerefMove;
-pub use emplace::Emplace;
+pub use destruct::Destruct;
+pub use emplace::{Emplace, EmplaceExtend, EmplaceSlice};
 pub use into_move::IntoMove;
 pub use move_ref::MoveRef;
-pub use new::{CopyNew, MoveNew, New};
+pub use new::{CopyNew, MoveNew, New, NewSlice};
+#[cfg(feature = "alloc")]
+pub use pool::{Pool, PoolCache, PoolGuard};
 pub use slot::Slot;
 pub use slot_storage::{SlotStorage, SlotStorageKind};
 
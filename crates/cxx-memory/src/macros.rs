@@ -121,6 +121,8 @@ macro_rules! trivial_move {
                     that.write(data);
                 }
             }
+
+            unsafe impl<$($($targs)*)?> $crate::destruct::Destruct for $ty {}
         )*
     }
 }
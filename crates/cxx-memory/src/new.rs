@@ -1,4 +1,4 @@
-use crate::{into_move::IntoMove, move_ref::MoveRef};
+use crate::{into_move::IntoMove, move_ref::MoveRef, slot_storage::SlotStorageTracker};
 use core::{mem::MaybeUninit, pin::Pin};
 
 pub unsafe trait New: Sized {
@@ -24,12 +24,69 @@ unsafe impl<N: New> TryNew for N {
     }
 }
 
+pub unsafe trait NewSlice: Sized {
+    type Output;
+
+    fn len(&self) -> usize;
+
+    unsafe fn new_slice(self, this: Pin<&mut [MaybeUninit<Self::Output>]>);
+}
+
+// NOTE: on error, implementations must leave every element of `this` uninitialized (destroying any that were built)
+pub unsafe trait TryNewSlice {
+    type Output;
+    type Error;
+
+    fn len(&self) -> usize;
+
+    unsafe fn try_new_slice(self, this: Pin<&mut [MaybeUninit<Self::Output>]>) -> Result<(), Self::Error>;
+}
+
+unsafe impl<N: NewSlice> TryNewSlice for N {
+    type Output = N::Output;
+    type Error = core::convert::Infallible;
+
+    fn len(&self) -> usize {
+        NewSlice::len(self)
+    }
+
+    unsafe fn try_new_slice(self, this: Pin<&mut [MaybeUninit<Self::Output>]>) -> Result<(), Self::Error> {
+        self.new_slice(this);
+        Ok(())
+    }
+}
+
 pub unsafe trait CopyNew: Sized {
     unsafe fn copy_new(src: &Self, dst: Pin<&mut MaybeUninit<Self>>);
+
+    // NOTE: implementations backed by FFI should override this to cross the language boundary once per slice
+    #[inline]
+    unsafe fn copy_new_n(src: &[Self], dst: Pin<&mut [MaybeUninit<Self>]>) {
+        let dst = Pin::into_inner_unchecked(dst);
+        debug_assert_eq!(src.len(), dst.len());
+        for (src, dst) in src.iter().zip(dst) {
+            Self::copy_new(src, Pin::new_unchecked(dst));
+        }
+    }
 }
 
 pub unsafe trait MoveNew: Sized {
     unsafe fn move_new(src: Pin<MoveRef<Self>>, dst: Pin<&mut MaybeUninit<Self>>);
+
+    // NOTE: relocates `src` into `dst`; every element of `src` is destroyed after having been moved from
+    #[inline]
+    unsafe fn move_new_n(src: Pin<MoveRef<[Self]>>, dst: Pin<&mut [MaybeUninit<Self>]>) {
+        let src = &mut *MoveRef::release(src);
+        let dst = Pin::into_inner_unchecked(dst);
+        debug_assert_eq!(src.len(), dst.len());
+        for (src, dst) in src.iter_mut().zip(dst) {
+            let tracker = SlotStorageTracker::new();
+            let status = tracker.status();
+            status.initialize();
+            let src = MoveRef::new_unchecked(src, status).into_pin();
+            Self::move_new(src, Pin::new_unchecked(dst));
+        }
+    }
 }
 
 #[inline]
@@ -96,6 +153,91 @@ where
     }
 }
 
+#[inline]
+pub unsafe fn slice_by_raw<T, F>(len: usize, f: F) -> impl NewSlice<Output = T>
+where
+    F: FnOnce(Pin<&mut [MaybeUninit<T>]>),
+{
+    struct FnNewSlice<F, T> {
+        len: usize,
+        f: F,
+        _type: core::marker::PhantomData<fn(Pin<&mut [MaybeUninit<T>]>)>,
+    }
+
+    unsafe impl<F, T> NewSlice for FnNewSlice<F, T>
+    where
+        F: FnOnce(Pin<&mut [MaybeUninit<T>]>),
+    {
+        type Output = T;
+        #[inline]
+        fn len(&self) -> usize {
+            self.len
+        }
+        #[inline]
+        unsafe fn new_slice(self, this: Pin<&mut [MaybeUninit<Self::Output>]>) {
+            debug_assert_eq!(self.len, this.len());
+            (self.f)(this)
+        }
+    }
+
+    FnNewSlice {
+        len,
+        f,
+        _type: core::marker::PhantomData,
+    }
+}
+
+#[inline]
+pub unsafe fn try_slice_by_raw<T, E, F>(len: usize, f: F) -> impl TryNewSlice<Output = T, Error = E>
+where
+    F: FnOnce(Pin<&mut [MaybeUninit<T>]>) -> Result<(), E>,
+{
+    struct FnTryNewSlice<F, T, E> {
+        len: usize,
+        f: F,
+        _type: core::marker::PhantomData<fn(Pin<&mut [MaybeUninit<T>]>) -> Result<(), E>>,
+    }
+
+    unsafe impl<F, T, E> TryNewSlice for FnTryNewSlice<F, T, E>
+    where
+        F: FnOnce(Pin<&mut [MaybeUninit<T>]>) -> Result<(), E>,
+    {
+        type Output = T;
+        type Error = E;
+        #[inline]
+        fn len(&self) -> usize {
+            self.len
+        }
+        #[inline]
+        unsafe fn try_new_slice(self, this: Pin<&mut [MaybeUninit<Self::Output>]>) -> Result<(), Self::Error> {
+            debug_assert_eq!(self.len, this.len());
+            (self.f)(this)
+        }
+    }
+
+    FnTryNewSlice {
+        len,
+        f,
+        _type: core::marker::PhantomData,
+    }
+}
+
+#[inline]
+pub fn copy_n<T: CopyNew>(src: &[T]) -> impl NewSlice<Output = T> + '_ {
+    unsafe { slice_by_raw(src.len(), move |dst| CopyNew::copy_new_n(src, dst)) }
+}
+
+#[inline]
+pub fn default_n<T: Default>(len: usize) -> impl NewSlice<Output = T> {
+    unsafe {
+        slice_by_raw(len, move |dst| {
+            for dst in Pin::into_inner_unchecked(dst) {
+                dst.write(T::default());
+            }
+        })
+    }
+}
+
 #[cfg(test)]
 mod test {
     use super::*;
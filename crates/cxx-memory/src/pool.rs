@@ -0,0 +1,410 @@
+use crate::new::{New, TryNew};
+use core::{
+    cell::Cell,
+    marker::PhantomData,
+    mem::MaybeUninit,
+    ops::{Deref, DerefMut},
+    pin::Pin,
+    ptr::NonNull,
+    sync::atomic::{AtomicBool, AtomicPtr, AtomicUsize, Ordering},
+};
+
+const POOL_CACHE_CAPACITY: usize = 32;
+
+struct PoolNode<T> {
+    next: *mut PoolNode<T>,
+    value: MaybeUninit<T>,
+}
+
+// NOTE: the global free list is a Treiber stack which is pushed to without locking, while `popping` lets only one cache
+// at a time pop from it. A node can then not be popped and pushed back while a pop is in progress, so the ABA problem
+// that affects a CAS-based pop cannot occur, and each pop takes a bounded batch rather than the whole list.
+pub struct Pool<T> {
+    head: AtomicPtr<PoolNode<T>>,
+    popping: AtomicBool,
+    constructed: AtomicUsize,
+    _type: PhantomData<T>,
+}
+
+// NOTE: pooled objects are only ever handed to one thread at a time, so sharing the pool only requires `T: Send`.
+// Types generated by `cxx-memory-abi` are `Send` when the binding opts in with `cxx_memory::abi::cxx_is_send`.
+unsafe impl<T: Send> Sync for Pool<T> {
+}
+
+impl<T> Default for Pool<T> {
+    #[inline]
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+impl<T> Drop for Pool<T> {
+    fn drop(&mut self) {
+        let mut node = self.head.swap(core::ptr::null_mut(), Ordering::Acquire);
+        while let Some(ptr) = NonNull::new(node) {
+            node = unsafe { (*ptr.as_ptr()).next };
+            unsafe { Self::free_node(ptr) };
+        }
+    }
+}
+
+impl<T> Pool<T> {
+    #[inline]
+    pub const fn new() -> Self {
+        Self {
+            head: AtomicPtr::new(core::ptr::null_mut()),
+            popping: AtomicBool::new(false),
+            constructed: AtomicUsize::new(0),
+            _type: PhantomData,
+        }
+    }
+
+    #[inline]
+    pub fn cache(&self) -> PoolCache<'_, T> {
+        self.cache_with_capacity(POOL_CACHE_CAPACITY)
+    }
+
+    #[inline]
+    pub fn cache_with_capacity(&self, capacity: usize) -> PoolCache<'_, T> {
+        PoolCache {
+            pool: self,
+            head: Cell::new(core::ptr::null_mut()),
+            tail: Cell::new(core::ptr::null_mut()),
+            len: Cell::new(0),
+            capacity,
+        }
+    }
+
+    // NOTE: the number of objects constructed by this pool so far, i.e., the number of times reuse was not possible
+    #[inline]
+    pub fn constructed(&self) -> usize {
+        self.constructed.load(Ordering::Relaxed)
+    }
+
+    #[inline]
+    fn push_chain(&self, first: NonNull<PoolNode<T>>, last: NonNull<PoolNode<T>>) {
+        let mut head = self.head.load(Ordering::Relaxed);
+        loop {
+            unsafe { (*last.as_ptr()).next = head };
+            match self
+                .head
+                .compare_exchange_weak(head, first.as_ptr(), Ordering::Release, Ordering::Relaxed)
+            {
+                Ok(_) => break,
+                Err(actual) => head = actual,
+            }
+        }
+    }
+
+    // NOTE: pops at most `max` objects (but at least one) as a chain, which is returned with its length. Gives up when
+    // another cache is popping, since the caller can always construct a new object instead of waiting.
+    #[inline]
+    fn pop_chain(&self, max: usize) -> Option<(NonNull<PoolNode<T>>, NonNull<PoolNode<T>>, usize)> {
+        if self.head.load(Ordering::Relaxed).is_null() || self.popping.swap(true, Ordering::Acquire) {
+            return None;
+        }
+        let mut head = self.head.load(Ordering::Acquire);
+        let chain = loop {
+            let Some(first) = NonNull::new(head) else {
+                break None;
+            };
+            let mut last = first;
+            let mut len = 1;
+            while len < max {
+                match NonNull::new(unsafe { (*last.as_ptr()).next }) {
+                    Some(next) => last = next,
+                    None => break,
+                }
+                len += 1;
+            }
+            let rest = unsafe { (*last.as_ptr()).next };
+            match self
+                .head
+                .compare_exchange_weak(head, rest, Ordering::Acquire, Ordering::Acquire)
+            {
+                Ok(_) => {
+                    unsafe { (*last.as_ptr()).next = core::ptr::null_mut() };
+                    break Some((first, last, len));
+                },
+                Err(actual) => head = actual,
+            }
+        };
+        self.popping.store(false, Ordering::Release);
+        chain
+    }
+
+    #[inline]
+    unsafe fn free_node(node: NonNull<PoolNode<T>>) {
+        let mut node = crate::Box::from_raw(node.as_ptr());
+        node.value.assume_init_drop();
+    }
+}
+
+pub struct PoolCache<'pool, T> {
+    pool: &'pool Pool<T>,
+    head: Cell<*mut PoolNode<T>>,
+    tail: Cell<*mut PoolNode<T>>,
+    len: Cell<usize>,
+    capacity: usize,
+}
+
+impl<T> Drop for PoolCache<'_, T> {
+    #[inline]
+    fn drop(&mut self) {
+        self.flush();
+    }
+}
+
+impl<'pool, T> PoolCache<'pool, T> {
+    // NOTE: `new` is only run when no pooled object is available; a reused object is handed out in whatever state it
+    // was in when it was returned to the pool.
+    #[inline]
+    pub fn take<N: New<Output = T>>(&self, new: N) -> PoolGuard<'_, 'pool, T> {
+        match self.try_take(new) {
+            Ok(guard) => guard,
+            Err(err) => match err {},
+        }
+    }
+
+    #[inline]
+    pub fn try_take<N: TryNew<Output = T>>(&self, new: N) -> Result<PoolGuard<'_, 'pool, T>, N::Error> {
+        let node = match self.pop() {
+            Some(node) => node,
+            None => self.construct(new)?,
+        };
+        Ok(PoolGuard { cache: self, node })
+    }
+
+    #[inline]
+    pub fn len(&self) -> usize {
+        self.len.get()
+    }
+
+    #[inline]
+    pub fn is_empty(&self) -> bool {
+        self.len.get() == 0
+    }
+
+    #[inline]
+    pub fn flush(&self) {
+        let head = self.head.replace(core::ptr::null_mut());
+        let tail = self.tail.replace(core::ptr::null_mut());
+        self.len.set(0);
+        if let (Some(first), Some(last)) = (NonNull::new(head), NonNull::new(tail)) {
+            self.pool.push_chain(first, last);
+        }
+    }
+
+    #[inline]
+    fn pop(&self) -> Option<NonNull<PoolNode<T>>> {
+        if self.head.get().is_null() {
+            self.refill();
+        }
+        let node = NonNull::new(self.head.get())?;
+        let next = unsafe { (*node.as_ptr()).next };
+        self.head.set(next);
+        if next.is_null() {
+            self.tail.set(core::ptr::null_mut());
+        }
+        self.len.set(self.len.get() - 1);
+        Some(node)
+    }
+
+    #[inline]
+    fn push(&self, node: NonNull<PoolNode<T>>) {
+        if self.len.get() >= self.capacity {
+            self.flush();
+        }
+        unsafe { (*node.as_ptr()).next = self.head.get() };
+        if self.tail.get().is_null() {
+            self.tail.set(node.as_ptr());
+        }
+        self.head.set(node.as_ptr());
+        self.len.set(self.len.get() + 1);
+    }
+
+    // NOTE: takes at most `capacity` objects (but at least one), so that a single cache cannot starve the others
+    #[cold]
+    fn refill(&self) {
+        if let Some((first, last, len)) = self.pool.pop_chain(self.capacity) {
+            self.head.set(first.as_ptr());
+            self.tail.set(last.as_ptr());
+            self.len.set(len);
+        }
+    }
+
+    #[cold]
+    fn construct<N: TryNew<Output = T>>(&self, new: N) -> Result<NonNull<PoolNode<T>>, N::Error> {
+        let node = crate::Box::new(PoolNode {
+            next: core::ptr::null_mut(),
+            value: MaybeUninit::uninit(),
+        });
+        let node = crate::Box::leak(node);
+        if let Err(err) = unsafe { new.try_new(Pin::new_unchecked(&mut node.value)) } {
+            drop(unsafe { crate::Box::from_raw(node) });
+            return Err(err);
+        }
+        self.pool.constructed.fetch_add(1, Ordering::Relaxed);
+        Ok(NonNull::from(node))
+    }
+}
+
+pub struct PoolGuard<'cache, 'pool, T> {
+    cache: &'cache PoolCache<'pool, T>,
+    node: NonNull<PoolNode<T>>,
+}
+
+impl<T> Drop for PoolGuard<'_, '_, T> {
+    #[inline]
+    fn drop(&mut self) {
+        self.cache.push(self.node);
+    }
+}
+
+impl<T> Deref for PoolGuard<'_, '_, T> {
+    type Target = T;
+
+    #[inline]
+    fn deref(&self) -> &Self::Target {
+        unsafe { (*self.node.as_ptr()).value.assume_init_ref() }
+    }
+}
+
+impl<T: Unpin> DerefMut for PoolGuard<'_, '_, T> {
+    #[inline]
+    fn deref_mut(&mut self) -> &mut Self::Target {
+        unsafe { (*self.node.as_ptr()).value.assume_init_mut() }
+    }
+}
+
+impl<T> PoolGuard<'_, '_, T> {
+    #[inline]
+    pub fn as_mut(&mut self) -> Pin<&mut T> {
+        unsafe { Pin::new_unchecked((*self.node.as_ptr()).value.assume_init_mut()) }
+    }
+}
+
+#[cfg(test)]
+mod test {
+    use super::*;
+
+    #[test]
+    fn take_reuses_returned_objects() {
+        let pool = Pool::<crate::Vec<u8>>::new();
+        let cache = pool.cache();
+        {
+            let mut vec = cache.take(crate::new::default());
+            vec.reserve(64);
+        }
+        let vec = cache.take(crate::new::default());
+        assert!(vec.capacity() >= 64);
+        assert_eq!(pool.constructed(), 1);
+    }
+
+    #[test]
+    fn flush_shares_objects_between_caches() {
+        let pool = Pool::<u32>::new();
+        {
+            let cache = pool.cache_with_capacity(2);
+            let guards = [(); 5].map(|_| cache.take(crate::new::of(7)));
+            drop(guards);
+        }
+        let cache = pool.cache();
+        let guards = [(); 5].map(|_| cache.take(crate::new::of(0)));
+        assert!(guards.iter().all(|guard| **guard == 7));
+        assert_eq!(pool.constructed(), 5);
+    }
+
+    #[test]
+    fn refill_takes_a_bounded_batch() {
+        let pool = Pool::<u32>::new();
+        {
+            let cache = pool.cache_with_capacity(8);
+            let guards = [(); 8].map(|_| cache.take(crate::new::of(7)));
+            drop(guards);
+        }
+        let cache = pool.cache_with_capacity(3);
+        let guard = cache.take(crate::new::of(0));
+        assert_eq!(*guard, 7);
+        assert_eq!(cache.len(), 2);
+        let other = pool.cache_with_capacity(8);
+        let guards = [(); 5].map(|_| other.take(crate::new::of(0)));
+        assert!(guards.iter().all(|guard| **guard == 7));
+        assert_eq!(pool.constructed(), 8);
+    }
+
+    #[cfg(feature = "std")]
+    #[test]
+    fn refill_leaves_objects_for_other_caches() {
+        let pool = Pool::<u32>::new();
+        {
+            let cache = pool.cache_with_capacity(8);
+            let guards = [(); 8].map(|_| cache.take(crate::new::of(7)));
+            drop(guards);
+        }
+        let barrier = &std::sync::Barrier::new(2);
+        let pool = &pool;
+        std::thread::scope(|scope| {
+            let first = scope.spawn(|| {
+                let cache = pool.cache_with_capacity(4);
+                let guards = [(); 4].map(|_| cache.take(crate::new::of(0)));
+                barrier.wait();
+                guards.iter().all(|guard| **guard == 7)
+            });
+            let second = scope.spawn(|| {
+                barrier.wait();
+                let cache = pool.cache_with_capacity(4);
+                let guards = [(); 4].map(|_| cache.take(crate::new::of(0)));
+                guards.iter().all(|guard| **guard == 7)
+            });
+            assert!(first.join().unwrap());
+            assert!(second.join().unwrap());
+        });
+        assert_eq!(pool.constructed(), 8);
+    }
+
+    #[cfg(feature = "std")]
+    #[test]
+    fn take_across_threads() {
+        let pool = Pool::<crate::Box<usize>>::new();
+        std::thread::scope(|scope| {
+            for _ in 0 .. 4 {
+                scope.spawn(|| {
+                    let cache = pool.cache_with_capacity(4);
+                    for i in 0 .. 1000 {
+                        let mut value = cache.take(crate::new::by(|| crate::Box::new(0)));
+                        **value = i;
+                    }
+                });
+            }
+        });
+        assert!(pool.constructed() <= 4 * 5);
+    }
+
+    // NOTE: small caches flush and refill on almost every take, so an object handed to two caches at once (e.g., after
+    // a pop hit the ABA problem) would be seen with another thread's marker
+    #[cfg(feature = "std")]
+    #[test]
+    fn take_never_hands_out_an_object_twice() {
+        let pool = Pool::<AtomicUsize>::new();
+        let barrier = std::sync::Barrier::new(4);
+        std::thread::scope(|scope| {
+            for thread in 1 ..= 4 {
+                let (pool, barrier) = (&pool, &barrier);
+                scope.spawn(move || {
+                    let cache = pool.cache_with_capacity(2);
+                    barrier.wait();
+                    for _ in 0 .. 100000 {
+                        let guards = [(); 3].map(|_| cache.take(crate::new::by(|| AtomicUsize::new(0))));
+                        for guard in &guards {
+                            assert_eq!(guard.swap(thread, Ordering::Relaxed), 0);
+                        }
+                        for guard in &guards {
+                            assert_eq!(guard.swap(0, Ordering::Relaxed), thread);
+                        }
+                    }
+                });
+            }
+        });
+    }
+}
@@ -0,0 +1,285 @@
+use core::sync::atomic::{AtomicBool, AtomicPtr, AtomicU32, AtomicU64, Ordering};
+
+#[derive(Clone, Copy, Debug, Eq, Hash, Ord, PartialEq, PartialOrd)]
+pub enum CxxAbiOp {
+    CopyNew,
+    MoveNew,
+    Destruct,
+    Eq,
+    Cmp,
+    Hash,
+    Debug,
+    Display,
+}
+
+impl CxxAbiOp {
+    pub const COUNT: usize = 8;
+
+    pub const ALL: [CxxAbiOp; CxxAbiOp::COUNT] = [
+        CxxAbiOp::CopyNew,
+        CxxAbiOp::MoveNew,
+        CxxAbiOp::Destruct,
+        CxxAbiOp::Eq,
+        CxxAbiOp::Cmp,
+        CxxAbiOp::Hash,
+        CxxAbiOp::Debug,
+        CxxAbiOp::Display,
+    ];
+
+    pub const fn name(self) -> &'static str {
+        match self {
+            CxxAbiOp::CopyNew => "copy_new",
+            CxxAbiOp::MoveNew => "move_new",
+            CxxAbiOp::Destruct => "destruct",
+            CxxAbiOp::Eq => "eq",
+            CxxAbiOp::Cmp => "cmp",
+            CxxAbiOp::Hash => "hash",
+            CxxAbiOp::Debug => "debug",
+            CxxAbiOp::Display => "display",
+        }
+    }
+}
+
+struct CxxAbiOpCounters {
+    calls: AtomicU64,
+    samples: AtomicU64,
+    sampled_nanos: AtomicU64,
+}
+
+impl CxxAbiOpCounters {
+    #[allow(clippy::declare_interior_mutable_const)]
+    const ZERO: Self = Self {
+        calls: AtomicU64::new(0),
+        samples: AtomicU64::new(0),
+        sampled_nanos: AtomicU64::new(0),
+    };
+
+    fn load(&self) -> CxxAbiOpSnapshot {
+        CxxAbiOpSnapshot {
+            calls: self.calls.load(Ordering::Relaxed),
+            samples: self.samples.load(Ordering::Relaxed),
+            sampled_nanos: self.sampled_nanos.load(Ordering::Relaxed),
+        }
+    }
+
+    fn take(&self) -> CxxAbiOpSnapshot {
+        CxxAbiOpSnapshot {
+            calls: self.calls.swap(0, Ordering::Relaxed),
+            samples: self.samples.swap(0, Ordering::Relaxed),
+            sampled_nanos: self.sampled_nanos.swap(0, Ordering::Relaxed),
+        }
+    }
+}
+
+// NOTE: generated modules only emit a `CxxAbiStats` static when the consuming crate enables its `cxx-abi-stats`
+// feature. Each instance links itself into a global list the first time it records, so snapshots only contain the
+// types that were actually used.
+pub struct CxxAbiStats {
+    rust_name: &'static str,
+    ops: [CxxAbiOpCounters; CxxAbiOp::COUNT],
+    registered: AtomicBool,
+    next: AtomicPtr<CxxAbiStats>,
+}
+
+static REGISTRY: AtomicPtr<CxxAbiStats> = AtomicPtr::new(core::ptr::null_mut());
+
+static SAMPLE_INTERVAL: AtomicU32 = AtomicU32::new(0);
+
+impl CxxAbiStats {
+    pub const fn new(rust_name: &'static str) -> Self {
+        Self {
+            rust_name,
+            ops: [CxxAbiOpCounters::ZERO; CxxAbiOp::COUNT],
+            registered: AtomicBool::new(false),
+            next: AtomicPtr::new(core::ptr::null_mut()),
+        }
+    }
+
+    pub fn rust_name(&self) -> &'static str {
+        self.rust_name
+    }
+
+    #[inline]
+    pub fn record<R>(&'static self, op: CxxAbiOp, f: impl FnOnce() -> R) -> R {
+        if !self.registered.load(Ordering::Relaxed) {
+            self.register();
+        }
+        let counters = &self.ops[op as usize];
+        let calls = counters.calls.fetch_add(1, Ordering::Relaxed);
+        #[cfg(feature = "std")]
+        {
+            let interval = SAMPLE_INTERVAL.load(Ordering::Relaxed);
+            if interval != 0 && calls % u64::from(interval) == 0 {
+                let start = std::time::Instant::now();
+                let result = f();
+                let nanos = u64::try_from(start.elapsed().as_nanos()).unwrap_or(u64::MAX);
+                counters.samples.fetch_add(1, Ordering::Relaxed);
+                counters.sampled_nanos.fetch_add(nanos, Ordering::Relaxed);
+                return result;
+            }
+        }
+        #[cfg(not(feature = "std"))]
+        let _ = calls;
+        f()
+    }
+
+    #[cold]
+    fn register(&'static self) {
+        if self.registered.swap(true, Ordering::Relaxed) {
+            return;
+        }
+        let node = self as *const Self as *mut Self;
+        let mut head = REGISTRY.load(Ordering::Relaxed);
+        loop {
+            self.next.store(head, Ordering::Relaxed);
+            match REGISTRY.compare_exchange_weak(head, node, Ordering::Release, Ordering::Relaxed) {
+                Ok(_) => break,
+                Err(current) => head = current,
+            }
+        }
+    }
+
+    pub fn snapshot(&self) -> CxxAbiStatsSnapshot {
+        CxxAbiStatsSnapshot {
+            rust_name: self.rust_name,
+            ops: CxxAbiOp::ALL.map(|op| self.ops[op as usize].load()),
+        }
+    }
+
+    // NOTE: unlike `snapshot` followed by `reset`, no calls recorded in between are lost
+    pub fn take(&self) -> CxxAbiStatsSnapshot {
+        CxxAbiStatsSnapshot {
+            rust_name: self.rust_name,
+            ops: CxxAbiOp::ALL.map(|op| self.ops[op as usize].take()),
+        }
+    }
+
+    pub fn reset(&self) {
+        for counters in &self.ops {
+            counters.take();
+        }
+    }
+}
+
+#[derive(Clone, Copy, Debug, Default, Eq, PartialEq)]
+pub struct CxxAbiOpSnapshot {
+    pub calls: u64,
+    pub samples: u64,
+    pub sampled_nanos: u64,
+}
+
+impl CxxAbiOpSnapshot {
+    pub fn mean_nanos(&self) -> Option<u64> {
+        self.sampled_nanos.checked_div(self.samples)
+    }
+}
+
+#[derive(Clone, Copy, Debug, Eq, PartialEq)]
+pub struct CxxAbiStatsSnapshot {
+    pub rust_name: &'static str,
+    pub ops: [CxxAbiOpSnapshot; CxxAbiOp::COUNT],
+}
+
+impl CxxAbiStatsSnapshot {
+    pub fn op(&self, op: CxxAbiOp) -> &CxxAbiOpSnapshot {
+        &self.ops[op as usize]
+    }
+}
+
+// NOTE: time every `interval`-th call of each operation; `0` (the default) disables timing and only counts calls
+pub fn set_sample_interval(interval: u32) {
+    SAMPLE_INTERVAL.store(interval, Ordering::Relaxed);
+}
+
+pub fn for_each(mut f: impl FnMut(&'static CxxAbiStats)) {
+    let mut node = REGISTRY.load(Ordering::Acquire);
+    while let Some(stats) = unsafe { node.as_ref() } {
+        f(stats);
+        node = stats.next.load(Ordering::Relaxed);
+    }
+}
+
+#[cfg(feature = "alloc")]
+pub fn snapshot() -> crate::Vec<CxxAbiStatsSnapshot> {
+    let mut snapshots = crate::Vec::new();
+    for_each(|stats| snapshots.push(stats.snapshot()));
+    snapshots
+}
+
+#[cfg(feature = "alloc")]
+pub fn take() -> crate::Vec<CxxAbiStatsSnapshot> {
+    let mut snapshots = crate::Vec::new();
+    for_each(|stats| snapshots.push(stats.take()));
+    snapshots
+}
+
+pub fn reset() {
+    for_each(CxxAbiStats::reset);
+}
+
+#[cfg(test)]
+mod test {
+    use super::*;
+
+    // NOTE: the registry and sample interval are global, so each test records into its own statics and only inspects
+    // those, which keeps the tests independent when run in parallel
+
+    fn is_registered(stats: &'static CxxAbiStats) -> usize {
+        let mut count = 0;
+        for_each(|other| count += usize::from(core::ptr::eq(stats, other)));
+        count
+    }
+
+    #[test]
+    fn registry_links_instances_on_first_record() {
+        static USED: CxxAbiStats = CxxAbiStats::new("Used");
+        static UNUSED: CxxAbiStats = CxxAbiStats::new("Unused");
+        assert_eq!(is_registered(&USED), 0);
+        USED.record(CxxAbiOp::Eq, || ());
+        USED.record(CxxAbiOp::Hash, || ());
+        assert_eq!(is_registered(&USED), 1);
+        assert_eq!(is_registered(&UNUSED), 0);
+        #[cfg(feature = "alloc")]
+        assert!(snapshot().iter().any(|snapshot| snapshot.rust_name == "Used"));
+    }
+
+    #[test]
+    fn snapshot_take_and_reset() {
+        static STATS: CxxAbiStats = CxxAbiStats::new("Counted");
+        for _ in 0 .. 3 {
+            assert!(STATS.record(CxxAbiOp::Eq, || true));
+        }
+        STATS.record(CxxAbiOp::Destruct, || ());
+        let snapshot = STATS.snapshot();
+        assert_eq!(snapshot.rust_name, "Counted");
+        assert_eq!(snapshot.op(CxxAbiOp::Eq).calls, 3);
+        assert_eq!(snapshot.op(CxxAbiOp::Destruct).calls, 1);
+        assert_eq!(snapshot.op(CxxAbiOp::Hash).calls, 0);
+        assert_eq!(STATS.snapshot(), snapshot);
+
+        assert_eq!(STATS.take(), snapshot);
+        assert_eq!(STATS.snapshot().op(CxxAbiOp::Eq).calls, 0);
+
+        STATS.record(CxxAbiOp::Cmp, || ());
+        STATS.reset();
+        assert!(STATS.snapshot().ops.iter().all(|op| *op == CxxAbiOpSnapshot::default()));
+    }
+
+    #[cfg(feature = "std")]
+    #[test]
+    fn sampling_times_every_nth_call() {
+        static STATS: CxxAbiStats = CxxAbiStats::new("Sampled");
+        set_sample_interval(4);
+        for _ in 0 .. 8 {
+            STATS.record(CxxAbiOp::CopyNew, || std::thread::sleep(core::time::Duration::from_micros(10)));
+        }
+        set_sample_interval(0);
+        for _ in 0 .. 8 {
+            STATS.record(CxxAbiOp::CopyNew, || ());
+        }
+        let snapshot = *STATS.snapshot().op(CxxAbiOp::CopyNew);
+        assert_eq!((snapshot.calls, snapshot.samples), (16, 2));
+        assert!(snapshot.mean_nanos().is_some_and(|nanos| nanos >= 10_000));
+        assert_eq!(CxxAbiOpSnapshot::default().mean_nanos(), None);
+    }
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include <string>
+#include <string_view>
+#include <cstddef>
+#include <cstdint>
+namespace rust {
+inline namespace cxxbridge1 {
+class String {
+public:
+  static String lossy(const std::string&) { return {}; }
+  static String lossy(const char*, std::size_t) { return {}; }
+};
+using string = String;
+class Str {
+public:
+  Str() = default;
+  Str(const char*, std::size_t) {}
+  Str(std::string_view) {}
+};
+using str = Str;
+template<typename T> class Slice {
+public:
+  Slice() = default;
+  Slice(T* p, std::size_t n) : p_(p), n_(n) {}
+  T* data() const noexcept { return p_; }
+  std::size_t size() const noexcept { return n_; }
+  bool empty() const noexcept { return n_ == 0; }
+  T* p_ = reinterpret_cast<T*>(1); std::size_t n_ = 0;
+};
+template<typename T> class Box {};
+}
+}